@@ -534,7 +534,7 @@ void BaseView::draw()
 		{
 			if (craft != _base->getCrafts()->end())
 			{
-				if ((*craft)->getStatus() != "STR_OUT")
+				if ((*craft)->getStatus() != CRAFT_OUT)
 				{
 					Surface *frame = _texture->getFrame((*craft)->getRules()->getSprite() + 33);
 					auto fx = ((*i)->getX() * GRID_SIZE + ((*i)->getRules()->getSize() - 1) * GRID_SIZE / 2 + 2);
@@ -40,7 +40,6 @@
 #include "../Mod/RuleSoldier.h"
 #include "../Ufopaedia/Ufopaedia.h"
 #include <algorithm>
-#include "../Engine/Unicode.h"
 
 namespace OpenXcom
 {
@@ -189,16 +188,11 @@ void CraftArmorState::cbxSortByChange(Action *action)
 		{
 			if (selIdx == 2)
 			{
-				std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(),
-					[](const Soldier* a, const Soldier* b)
-					{
-						return Unicode::naturalCompare(a->getName(), b->getName());
-					}
-				);
+				sortSoldiersByName(*_base->getSoldiers());
 			}
 			else
 			{
-				std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(), *compFunc);
+				sortSoldiers(_game, *_base->getSoldiers(), compFunc->getGetter());
 			}
 			bool shiftPressed = SDL_GetModState() & KMOD_SHIFT;
 			if (shiftPressed)
@@ -432,7 +426,7 @@ void CraftArmorState::lstSoldiersClick(Action *action)
 	}
 
 	Soldier *s = _base->getSoldiers()->at(_lstSoldiers->getSelectedRow());
-	if (!(s->getCraft() && s->getCraft()->getStatus() == "STR_OUT"))
+	if (!(s->getCraft() && s->getCraft()->getStatus() == CRAFT_OUT))
 	{
 		if (action->getDetails()->button.button == SDL_BUTTON_LEFT)
 		{
@@ -519,7 +513,7 @@ void CraftArmorState::btnDeequipAllArmorClick(Action *action)
 	int row = 0;
 	for (std::vector<Soldier*>::iterator i = _base->getSoldiers()->begin(); i != _base->getSoldiers()->end(); ++i)
 	{
-		if (!((*i)->getCraft() && (*i)->getCraft()->getStatus() == "STR_OUT"))
+		if (!((*i)->getCraft() && (*i)->getCraft()->getStatus() == CRAFT_OUT))
 		{
 			Armor *a = _game->getMod()->getArmor((*i)->getRules()->getArmor());
 
@@ -38,7 +38,6 @@
 #include "SoldierInfoState.h"
 #include "../Mod/Armor.h"
 #include "../Mod/RuleInterface.h"
-#include "../Engine/Unicode.h"
 
 namespace OpenXcom
 {
@@ -196,16 +195,11 @@ void CraftSoldiersState::cbxSortByChange(Action *)
 		{
 			if (selIdx == 2)
 			{
-				std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(),
-					[](const Soldier* a, const Soldier* b)
-					{
-						return Unicode::naturalCompare(a->getName(), b->getName());
-					}
-				);
+				sortSoldiersByName(*_base->getSoldiers());
 			}
 			else
 			{
-				std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(), *compFunc);
+				sortSoldiers(_game, *_base->getSoldiers(), compFunc->getGetter());
 			}
 			bool shiftPressed = SDL_GetModState() & KMOD_SHIFT;
 			if (shiftPressed)
@@ -442,7 +436,7 @@ void CraftSoldiersState::lstSoldiersClick(Action *action)
 			s->setCraft(0);
 			_lstSoldiers->setCellText(row, 2, tr("STR_NONE_UC"));
 		}
-		else if (s->getCraft() && s->getCraft()->getStatus() == "STR_OUT")
+		else if (s->getCraft() && s->getCraft()->getStatus() == CRAFT_OUT)
 		{
 			color = _otherCraftColor;
 		}
@@ -514,12 +508,12 @@ void CraftSoldiersState::btnDeassignAllSoldiersClick(Action *action)
 	for (std::vector<Soldier*>::iterator i = _base->getSoldiers()->begin(); i != _base->getSoldiers()->end(); ++i)
 	{
 		color = _lstSoldiers->getColor();
-		if ((*i)->getCraft() && (*i)->getCraft()->getStatus() != "STR_OUT")
+		if ((*i)->getCraft() && (*i)->getCraft()->getStatus() != CRAFT_OUT)
 		{
 			(*i)->setCraft(0);
 			_lstSoldiers->setCellText(row, 2, tr("STR_NONE_UC"));
 		}
-		else if ((*i)->getCraft() && (*i)->getCraft()->getStatus() == "STR_OUT")
+		else if ((*i)->getCraft() && (*i)->getCraft()->getStatus() == CRAFT_OUT)
 		{
 			color = _otherCraftColor;
 		}
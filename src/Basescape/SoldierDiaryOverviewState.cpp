@@ -214,35 +214,27 @@ void SoldierDiaryOverviewState::init()
 
 	_lstDiary->clearList();
 
-	std::vector<MissionStatistics*> *missionStatistics = _game->getSavedGame()->getMissionStatistics();
+	const std::vector<int> &missionIdList = _soldier->getDiary()->getMissionIdList();
 
 	unsigned int row = 0;
-	for (std::vector<MissionStatistics*>::iterator j = missionStatistics->begin() ; j != missionStatistics->end() ; ++j)
+	for (std::vector<int>::const_iterator k = missionIdList.begin(); k != missionIdList.end(); ++k)
 	{
-		int missionId = (*j)->id;
-		bool wasOnMission = false;
-
-		// See if this mission is part of the soldier's vector of missions
-		for (std::vector<int>::const_iterator k = _soldier->getDiary()->getMissionIdList().begin(); k != _soldier->getDiary()->getMissionIdList().end(); ++k)
-		{
-			if (missionId == (*k))
-			{
-				wasOnMission = true;
-				break;
-			}
-		}
-		if (!wasOnMission)
+		MissionStatistics *ms = _game->getSavedGame()->getMissionStatistics(*k);
+		if (ms == 0)
 		{
+			// keep a row anyway, the mission screen opens the mission by its row
+			_lstDiary->addRow(5, tr("STR_UNKNOWN").c_str(), "", "", "", "");
+			row++;
 			continue;
 		}
 
 		std::ostringstream ss;
-		ss << (*j)->time.getYear();
+		ss << ms->time.getYear();
 
-		_lstDiary->addRow(5, (*j)->getMissionName(_game->getLanguage()).c_str(),
-							 (*j)->getRatingString(_game->getLanguage()).c_str(),
-							 (*j)->time.getDayString(_game->getLanguage()).c_str(),
-							 tr((*j)->time.getMonthString()).c_str(),
+		_lstDiary->addRow(5, ms->getMissionName(_game->getLanguage()).c_str(),
+							 ms->getRatingString(_game->getLanguage()).c_str(),
+							 ms->time.getDayString(_game->getLanguage()).c_str(),
+							 tr(ms->time.getMonthString()).c_str(),
 							 ss.str().c_str());
 		row++;
 	}
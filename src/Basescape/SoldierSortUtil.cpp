@@ -1,4 +1,6 @@
 #include "SoldierSortUtil.h"
+#include <algorithm>
+#include "../Engine/Unicode.h"
 #include "../Mod/RuleSoldier.h"
 
 #define GET_ATTRIB_STAT_FN(attrib) \
@@ -63,3 +65,55 @@ int OpenXcom::woundRecoveryStat(Game *game, Soldier *s)
 }
 GET_SOLDIER_STAT_FN(manaMissing, ManaMissing)
 #undef GET_SOLDIER_STAT_FN
+
+/**
+ * Sorts soldiers by a stat, keeping equal ones in their current order.
+ * Each stat is only worked out once per soldier instead of on every
+ * comparison, since some of them need to check the research.
+ * @param game Pointer to the game.
+ * @param soldiers List of soldiers to sort.
+ * @param getStatFn Getter of the stat to sort by.
+ */
+void OpenXcom::sortSoldiers(Game *game, std::vector<Soldier*> &soldiers, getStatFn_t getStatFn)
+{
+	std::vector<std::pair<int, Soldier*> > keys;
+	keys.reserve(soldiers.size());
+	for (std::vector<Soldier*>::const_iterator i = soldiers.begin(); i != soldiers.end(); ++i)
+	{
+		keys.push_back(std::make_pair(getStatFn(game, *i), *i));
+	}
+	std::stable_sort(keys.begin(), keys.end(),
+		[](const std::pair<int, Soldier*> &a, const std::pair<int, Soldier*> &b)
+		{
+			return a.first < b.first;
+		}
+	);
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		soldiers[i] = keys[i].second;
+	}
+}
+
+/**
+ * Sorts soldiers by name, keeping equal ones in their current order.
+ * @param soldiers List of soldiers to sort.
+ */
+void OpenXcom::sortSoldiersByName(std::vector<Soldier*> &soldiers)
+{
+	std::vector<std::pair<std::string, Soldier*> > keys;
+	keys.reserve(soldiers.size());
+	for (std::vector<Soldier*>::const_iterator i = soldiers.begin(); i != soldiers.end(); ++i)
+	{
+		keys.push_back(std::make_pair((*i)->getName(), *i));
+	}
+	std::stable_sort(keys.begin(), keys.end(),
+		[](const std::pair<std::string, Soldier*> &a, const std::pair<std::string, Soldier*> &b)
+		{
+			return Unicode::naturalCompare(a.first, b.first);
+		}
+	);
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		soldiers[i] = keys[i].second;
+	}
+}
@@ -75,4 +75,9 @@ GET_SOLDIER_STAT_FN(woundRecovery, WoundRecovery)
 GET_SOLDIER_STAT_FN(manaMissing, ManaMissing)
 #undef GET_SOLDIER_STAT_FN
 
+/// Sorts soldiers by a stat, keeping equal ones in their current order.
+void sortSoldiers(Game *game, std::vector<Soldier*> &soldiers, getStatFn_t getStatFn);
+/// Sorts soldiers by name, keeping equal ones in their current order.
+void sortSoldiersByName(std::vector<Soldier*> &soldiers);
+
 }
@@ -42,7 +42,6 @@
 #include "../Battlescape/BattlescapeGenerator.h"
 #include "../Savegame/SavedBattleGame.h"
 #include <algorithm>
-#include "../Engine/Unicode.h"
 
 namespace OpenXcom
 {
@@ -260,16 +259,11 @@ void SoldiersState::cbxSortByChange(Action *action)
 		{
 			if (selIdx == 2)
 			{
-				std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(),
-					[](const Soldier* a, const Soldier* b)
-					{
-						return Unicode::naturalCompare(a->getName(), b->getName());
-					}
-				);
+				sortSoldiersByName(*_base->getSoldiers());
 			}
 			else
 			{
-				std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(), *compFunc);
+				sortSoldiers(_game, *_base->getSoldiers(), compFunc->getGetter());
 			}
 			bool shiftPressed = SDL_GetModState() & KMOD_SHIFT;
 			if (shiftPressed)
@@ -350,7 +344,7 @@ void SoldiersState::initList(size_t scrl)
 		{
 			for (auto& soldier : *_base->getSoldiers())
 			{
-				if (soldier->getCraft() && soldier->getCraft()->getStatus() == "STR_OUT")
+				if (soldier->getCraft() && soldier->getCraft()->getStatus() == CRAFT_OUT)
 				{
 					// soldiers outside of the base are not eligible
 					continue;
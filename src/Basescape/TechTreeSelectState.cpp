@@ -189,10 +189,10 @@ void TechTreeSelectState::initLists()
 	}
 
 	const std::vector<std::string>& researchItems = _game->getMod()->getResearchList();
+	const std::vector<std::string> &researchNames = _parent->getSearchNames(TTV_RESEARCH);
 	for (std::vector<std::string>::const_iterator i = researchItems.begin(); i != researchItems.end(); ++i)
 	{
-		std::string projectName = tr((*i));
-		Unicode::upperCase(projectName);
+		const std::string &projectName = researchNames[i - researchItems.begin()];
 		if (searchString == "SHAZAM")
 		{
 			if (_parent->isDiscoveredResearch(*i))
@@ -217,10 +217,10 @@ void TechTreeSelectState::initLists()
 	_firstManufacturingTopicIndex = row;
 
 	const std::vector<std::string> &manufacturingItems = _game->getMod()->getManufactureList();
+	const std::vector<std::string> &manufacturingNames = _parent->getSearchNames(TTV_MANUFACTURING);
 	for (std::vector<std::string>::const_iterator i = manufacturingItems.begin(); i != manufacturingItems.end(); ++i)
 	{
-		std::string projectName = tr((*i));
-		Unicode::upperCase(projectName);
+		const std::string &projectName = manufacturingNames[i - manufacturingItems.begin()];
 		if (searchString == "SHAZAM")
 		{
 			if (_parent->isDiscoveredManufacture(*i))
@@ -248,10 +248,10 @@ void TechTreeSelectState::initLists()
 	_firstFacilitiesTopicIndex = row;
 
 	const std::vector<std::string> &facilityItems = _game->getMod()->getBaseFacilitiesList();
+	const std::vector<std::string> &facilityNames = _parent->getSearchNames(TTV_FACILITIES);
 	for (std::vector<std::string>::const_iterator i = facilityItems.begin(); i != facilityItems.end(); ++i)
 	{
-		std::string facilityName = tr((*i));
-		Unicode::upperCase(facilityName);
+		const std::string &facilityName = facilityNames[i - facilityItems.begin()];
 		if (searchString == "SHAZAM")
 		{
 			if (_parent->isDiscoveredFacility(*i))
@@ -279,6 +279,7 @@ void TechTreeSelectState::initLists()
 	_firstItemTopicIndex = row;
 
 	const std::vector<std::string> &itemsList = _game->getMod()->getItemsList();
+	const std::vector<std::string> &itemNames = _parent->getSearchNames(TTV_ITEMS);
 	for (std::vector<std::string>::const_iterator i = itemsList.begin(); i != itemsList.end(); ++i)
 	{
 		if (!_parent->isProtectedItem(*i))
@@ -286,8 +287,7 @@ void TechTreeSelectState::initLists()
 			// items that are not protected at all are irrelevant for the Tech Tree Viewer!
 			continue;
 		}
-		std::string itemName = tr((*i));
-		Unicode::upperCase(itemName);
+		const std::string &itemName = itemNames[i - itemsList.begin()];
 		if (searchString == "SHAZAM")
 		{
 			if (_parent->isProtectedAndDiscoveredItem(*i))
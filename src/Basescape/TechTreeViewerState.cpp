@@ -29,6 +29,7 @@
 #include "../Mod/RuleResearch.h"
 #include "../Engine/LocalizedText.h"
 #include "../Engine/Options.h"
+#include "../Engine/Unicode.h"
 #include "../Interface/Window.h"
 #include "../Interface/Text.h"
 #include "../Interface/TextButton.h"
@@ -43,7 +44,7 @@ namespace OpenXcom
 /**
  * Initializes all the elements on the UI.
  */
-TechTreeViewerState::TechTreeViewerState(const RuleResearch *r, const RuleManufacture *m, const RuleBaseFacility *f)
+TechTreeViewerState::TechTreeViewerState(const RuleResearch *r, const RuleManufacture *m, const RuleBaseFacility *f) : _researchLinksReady(false)
 {
 	if (r != 0)
 	{
@@ -291,126 +292,24 @@ void TechTreeViewerState::initLists()
 		}
 		//
 
-		const std::vector<std::string> &researchList = _game->getMod()->getResearchList();
-		const std::vector<std::string> &manufactureList = _game->getMod()->getManufactureList();
-
 		// 0. common pre-calculation
 		const std::vector<const RuleResearch*> reqs = rule->getRequirements();
 		const std::vector<const RuleResearch*> deps = rule->getDependencies();
-		std::vector<std::string> unlockedBy;
-		std::vector<std::string> disabledBy;
-		std::vector<std::string> getForFreeFrom;
-		std::vector<std::string> lookupOf;
-		std::vector<std::string> requiredByResearch;
-		std::vector<std::string> requiredByManufacture;
-		std::vector<std::string> requiredByFacilities;
-		std::vector<std::string> requiredByItems;
-		std::vector<std::string> leadsTo;
+		const ResearchLinks &links = getResearchLinks(rule->getName());
+		const std::vector<std::string> &unlockedBy = links.unlockedBy;
+		const std::vector<std::string> &disabledBy = links.disabledBy;
+		const std::vector<std::string> &getForFreeFrom = links.getForFreeFrom;
+		const std::vector<std::string> &lookupOf = links.lookupOf;
+		const std::vector<std::string> &requiredByResearch = links.requiredByResearch;
+		const std::vector<std::string> &requiredByManufacture = links.requiredByManufacture;
+		const std::vector<std::string> &requiredByFacilities = links.requiredByFacilities;
+		const std::vector<std::string> &requiredByItems = links.requiredByItems;
+		const std::vector<std::string> &leadsTo = links.leadsTo;
 		const std::vector<const RuleResearch*> unlocks = rule->getUnlocked();
 		const std::vector<const RuleResearch*> disables = rule->getDisabled();
 		const std::vector<const RuleResearch*> free = rule->getGetOneFree();
 		const std::map<const RuleResearch*, std::vector<const RuleResearch*> > freeProtected = rule->getGetOneFreeProtected();
 
-		for (auto& j : manufactureList)
-		{
-			RuleManufacture *temp = _game->getMod()->getManufacture(j);
-			for (auto& i : temp->getRequirements())
-			{
-				if (i == rule)
-				{
-					requiredByManufacture.push_back(j);
-				}
-			}
-		}
-
-		for (auto &f : _game->getMod()->getBaseFacilitiesList())
-		{
-			RuleBaseFacility *temp = _game->getMod()->getBaseFacility(f);
-			for (auto &i : temp->getRequirements())
-			{
-				if (i == rule->getName())
-				{
-					requiredByFacilities.push_back(f);
-				}
-			}
-		}
-
-		for (auto &item : _game->getMod()->getItemsList())
-		{
-			RuleItem *temp = _game->getMod()->getItem(item);
-			for (auto &i : temp->getRequirements())
-			{
-				if (i == rule)
-				{
-					requiredByItems.push_back(item);
-				}
-			}
-			for (auto &i : temp->getBuyRequirements())
-			{
-				if (i == rule)
-				{
-					requiredByItems.push_back(item);
-				}
-			}
-		}
-
-		for (auto& j : researchList)
-		{
-			RuleResearch *temp = _game->getMod()->getResearch(j);
-			for (auto& i : temp->getUnlocked())
-			{
-				if (i == rule)
-				{
-					unlockedBy.push_back(j);
-				}
-			}
-			for (auto& i : temp->getDisabled())
-			{
-				if (i == rule)
-				{
-					disabledBy.push_back(j);
-				}
-			}
-			for (auto& i : temp->getGetOneFree())
-			{
-				if (i == rule)
-				{
-					getForFreeFrom.push_back(j);
-				}
-			}
-			for (auto& itMap : temp->getGetOneFreeProtected())
-			{
-				for (auto& i : itMap.second)
-				{
-					if (i == rule)
-					{
-						getForFreeFrom.push_back(j);
-					}
-				}
-			}
-			if (!temp->getLookup().empty())
-			{
-				if (temp->getLookup() == rule->getName())
-				{
-					lookupOf.push_back(j);
-				}
-			}
-			for (auto& i : temp->getRequirements())
-			{
-				if (i == rule)
-				{
-					requiredByResearch.push_back(j);
-				}
-			}
-			for (auto& i : temp->getDependencies())
-			{
-				if (i == rule)
-				{
-					leadsTo.push_back(j);
-				}
-			}
-		}
-
 		// 1. item required
 		if (rule->needItem())
 		{
@@ -1295,6 +1194,141 @@ void TechTreeViewerState::initLists()
 	}
 }
 
+/**
+ * Gets the topics that point to a research topic in some way.
+ * These are worked out for all the research at once, the first
+ * time they're needed, instead of searching every rule each time
+ * a topic is shown.
+ * @param topic Research topic.
+ * @return Links to the topic.
+ */
+const TechTreeViewerState::ResearchLinks &TechTreeViewerState::getResearchLinks(const std::string &topic)
+{
+	if (!_researchLinksReady)
+	{
+		for (auto& j : _game->getMod()->getManufactureList())
+		{
+			RuleManufacture *temp = _game->getMod()->getManufacture(j);
+			for (auto& i : temp->getRequirements())
+			{
+				_researchLinks[i->getName()].requiredByManufacture.push_back(j);
+			}
+		}
+
+		for (auto &f : _game->getMod()->getBaseFacilitiesList())
+		{
+			RuleBaseFacility *temp = _game->getMod()->getBaseFacility(f);
+			for (auto &i : temp->getRequirements())
+			{
+				_researchLinks[i].requiredByFacilities.push_back(f);
+			}
+		}
+
+		for (auto &item : _game->getMod()->getItemsList())
+		{
+			RuleItem *temp = _game->getMod()->getItem(item);
+			for (auto &i : temp->getRequirements())
+			{
+				_researchLinks[i->getName()].requiredByItems.push_back(item);
+			}
+			for (auto &i : temp->getBuyRequirements())
+			{
+				_researchLinks[i->getName()].requiredByItems.push_back(item);
+			}
+		}
+
+		for (auto& j : _game->getMod()->getResearchList())
+		{
+			RuleResearch *temp = _game->getMod()->getResearch(j);
+			for (auto& i : temp->getUnlocked())
+			{
+				_researchLinks[i->getName()].unlockedBy.push_back(j);
+			}
+			for (auto& i : temp->getDisabled())
+			{
+				_researchLinks[i->getName()].disabledBy.push_back(j);
+			}
+			for (auto& i : temp->getGetOneFree())
+			{
+				_researchLinks[i->getName()].getForFreeFrom.push_back(j);
+			}
+			for (auto& itMap : temp->getGetOneFreeProtected())
+			{
+				for (auto& i : itMap.second)
+				{
+					_researchLinks[i->getName()].getForFreeFrom.push_back(j);
+				}
+			}
+			if (!temp->getLookup().empty())
+			{
+				_researchLinks[temp->getLookup()].lookupOf.push_back(j);
+			}
+			for (auto& i : temp->getRequirements())
+			{
+				_researchLinks[i->getName()].requiredByResearch.push_back(j);
+			}
+			for (auto& i : temp->getDependencies())
+			{
+				_researchLinks[i->getName()].leadsTo.push_back(j);
+			}
+		}
+		_researchLinksReady = true;
+	}
+	return _researchLinks[topic];
+}
+
+/**
+ * Gets the upper case names of all the topics of a kind, in the same
+ * order as their list in the mod, for the quick search. They are only
+ * translated once instead of on every search.
+ * Items that aren't protected by any research are left blank.
+ * @param mode Kind of topics.
+ * @return Names of the topics.
+ */
+const std::vector<std::string> &TechTreeViewerState::getSearchNames(TTVMode mode)
+{
+	std::map<TTVMode, std::vector<std::string> >::iterator cached = _searchNames.find(mode);
+	if (cached != _searchNames.end())
+	{
+		return cached->second;
+	}
+
+	const std::vector<std::string> *topics = 0;
+	switch (mode)
+	{
+	case TTV_RESEARCH:
+		topics = &_game->getMod()->getResearchList();
+		break;
+	case TTV_MANUFACTURING:
+		topics = &_game->getMod()->getManufactureList();
+		break;
+	case TTV_FACILITIES:
+		topics = &_game->getMod()->getBaseFacilitiesList();
+		break;
+	case TTV_ITEMS:
+		topics = &_game->getMod()->getItemsList();
+		break;
+	default:
+		break;
+	}
+	std::vector<std::string> &names = _searchNames[mode];
+	if (topics)
+	{
+		names.reserve(topics->size());
+		for (std::vector<std::string>::const_iterator i = topics->begin(); i != topics->end(); ++i)
+		{
+			std::string name;
+			if (mode != TTV_ITEMS || isProtectedItem(*i))
+			{
+				name = tr(*i);
+				Unicode::upperCase(name);
+			}
+			names.push_back(name);
+		}
+	}
+	return names;
+}
+
 /**
 * Selects the topic.
 * @param action Pointer to an action.
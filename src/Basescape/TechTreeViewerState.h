@@ -21,6 +21,7 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace OpenXcom
@@ -53,6 +54,17 @@ private:
 	std::vector<TTVMode> _leftFlags, _rightFlags;
 	std::unordered_set<std::string> _alreadyAvailableResearch, _alreadyAvailableManufacture, _alreadyAvailableFacilities;
 	std::unordered_set<std::string> _protectedItems, _alreadyAvailableItems;
+	/// Topics pointing to a research topic.
+	struct ResearchLinks
+	{
+		std::vector<std::string> unlockedBy, disabledBy, getForFreeFrom, lookupOf, leadsTo;
+		std::vector<std::string> requiredByResearch, requiredByManufacture, requiredByFacilities, requiredByItems;
+	};
+	std::unordered_map<std::string, ResearchLinks> _researchLinks;
+	bool _researchLinksReady;
+	std::map<TTVMode, std::vector<std::string> > _searchNames;
+	/// Gets the topics pointing to a research topic.
+	const ResearchLinks &getResearchLinks(const std::string &topic);
 	void initLists();
 	void onSelectLeftTopic(Action *action);
 	void onSelectRightTopic(Action *action);
@@ -79,6 +91,8 @@ public:
 	bool isProtectedItem(const std::string &topic) const;
 	/// Is given protected item discovered/available for both purchase and usage/equipment?
 	bool isProtectedAndDiscoveredItem(const std::string &topic) const;
+	/// Gets the upper case names of all topics of a kind, for searching.
+	const std::vector<std::string> &getSearchNames(TTVMode mode);
 };
 
 }
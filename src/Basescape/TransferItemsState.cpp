@@ -166,7 +166,7 @@ TransferItemsState::TransferItemsState(Base *baseFrom, Base *baseTo, DebriefingS
 	for (std::vector<Craft*>::iterator i = _baseFrom->getCrafts()->begin(); i != _baseFrom->getCrafts()->end(); ++i)
 	{
 		if (_debriefingState) break;
-		if ((*i)->getStatus() != "STR_OUT" || (Options::canTransferCraftsWhileAirborne && (*i)->getFuel() >= (*i)->getFuelLimit(_baseTo)))
+		if ((*i)->getStatus() != CRAFT_OUT || (Options::canTransferCraftsWhileAirborne && (*i)->getFuel() >= (*i)->getFuelLimit(_baseTo)))
 		{
 			TransferRow row = { TRANSFER_CRAFT, (*i), (*i)->getName(_game->getLanguage()),  (int)(25 * _distance), 1, 0, 0 };
 			_items.push_back(row);
@@ -536,7 +536,7 @@ void TransferItemsState::completeTransfer()
 					{
 						(*s)->setPsiTraining(false);
 						(*s)->setTraining(false);
-						if (craft->getStatus() == "STR_OUT")
+						if (craft->getStatus() == CRAFT_OUT)
 						{
 							_baseTo->getSoldiers()->push_back(*s);
 						}
@@ -556,10 +556,10 @@ void TransferItemsState::completeTransfer()
 
 				// Transfer craft
 				_baseFrom->removeCraft(craft, false);
-				if (craft->getStatus() == "STR_OUT")
+				if (craft->getStatus() == CRAFT_OUT)
 				{
 					bool returning = (craft->getDestination() == (Target*)craft->getBase());
-					_baseTo->getCrafts()->push_back(craft);
+					_baseTo->addCraft(craft);
 					craft->setBase(_baseTo, false);
 					if (craft->getFuel() <= craft->getFuelLimit(_baseTo))
 					{
@@ -845,7 +845,7 @@ void TransferItemsState::increaseByValue(int change)
 			_pQty += craft->getNumSoldiers();
 			_iQty += craft->getItems()->getTotalSize(_game->getMod());
 			getRow().amount++;
-			if (!Options::canTransferCraftsWhileAirborne || craft->getStatus() != "STR_OUT")
+			if (!Options::canTransferCraftsWhileAirborne || craft->getStatus() != CRAFT_OUT)
 				_total += getRow().cost;
 			break;
 		case TRANSFER_ITEM:
@@ -927,7 +927,7 @@ void TransferItemsState::decreaseByValue(int change)
 		break;
 	}
 	getRow().amount -= change;
-	if (!Options::canTransferCraftsWhileAirborne || 0 == craft || craft->getStatus() != "STR_OUT")
+	if (!Options::canTransferCraftsWhileAirborne || 0 == craft || craft->getStatus() != CRAFT_OUT)
 		_total -= getRow().cost * change;
 	updateItemStrings();
 }
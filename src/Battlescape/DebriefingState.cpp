@@ -1831,7 +1831,7 @@ void DebriefingState::prepareDebriefing()
 			// reequip crafts (only those on the base) after a base defense mission
 			for (std::vector<Craft*>::iterator c = base->getCrafts()->begin(); c != base->getCrafts()->end(); ++c)
 			{
-				if ((*c)->getStatus() != "STR_OUT")
+				if ((*c)->getStatus() != CRAFT_OUT)
 					reequipCraft(base, *c, false);
 			}
 		}
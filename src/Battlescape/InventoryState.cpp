@@ -667,7 +667,7 @@ void InventoryState::btnArmorClick(Action *action)
 	BattleUnit *unit = _battleGame->getSelectedUnit();
 	Soldier *s = unit->getGeoscapeSoldier();
 
-	if (!(s->getCraft() && s->getCraft()->getStatus() == "STR_OUT"))
+	if (!(s->getCraft() && s->getCraft()->getStatus() == CRAFT_OUT))
 	{
 		size_t soldierIndex = 0;
 		for (std::vector<Soldier*>::iterator i = _base->getSoldiers()->begin(); i != _base->getSoldiers()->end(); ++i)
@@ -699,7 +699,7 @@ void InventoryState::btnArmorClickRight(Action *action)
 	BattleUnit *unit = _battleGame->getSelectedUnit();
 	Soldier *s = unit->getGeoscapeSoldier();
 
-	if (!(s->getCraft() && s->getCraft()->getStatus() == "STR_OUT"))
+	if (!(s->getCraft() && s->getCraft()->getStatus() == CRAFT_OUT))
 	{
 		size_t soldierIndex = 0;
 		for (std::vector<Soldier*>::iterator i = _base->getSoldiers()->begin(); i != _base->getSoldiers()->end(); ++i)
@@ -1592,7 +1592,7 @@ void InventoryState::onMoveGroundInventoryToBase(Action *)
 	Soldier *s = unit->getGeoscapeSoldier();
 	Craft *c = s->getCraft();
 
-	if (c == 0 || c->getStatus() == "STR_OUT")
+	if (c == 0 || c->getStatus() == CRAFT_OUT)
 	{
 		// we're either not in a craft or not in a hangar (should not happen, but just in case)
 		return;
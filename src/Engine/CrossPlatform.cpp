@@ -26,6 +26,7 @@
 #include <fstream>
 #include <string>
 #include <list>
+#include <mutex>
 #include <stdint.h>
 #include <time.h>
 #include <signal.h>
@@ -878,6 +879,34 @@ time_t getDateModified(const std::string &path)
 #endif
 }
 
+/**
+ * Gets the size of a file.
+ * @param path Full path to file.
+ * @return Size in bytes, 0 if it doesn't exist.
+ */
+Uint64 getFileSize(const std::string &path)
+{
+#ifdef _WIN32
+	auto pathW = pathToWindows(path);
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	if (GetFileAttributesExW(pathW.c_str(), GetFileExInfoStandard, &data))
+	{
+		return ((Uint64)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+	}
+	return 0;
+#else
+	struct stat info;
+	if (stat(path.c_str(), &info) == 0)
+	{
+		return info.st_size;
+	}
+	else
+	{
+		return 0;
+	}
+#endif
+}
+
 /**
  * Converts a date/time into a human-readable string
  * using the ISO 8601 standard.
@@ -1470,6 +1499,8 @@ static bool logToFile(const std::string& filename, const std::string& data) {
 static const size_t LOG_BUFFER_LIMIT = 1<<10;
 static std::list<std::pair<int, std::string>> logBuffer;
 static std::string logFileName;
+/// Messages can come from worker threads, like the ones reading save headers.
+static std::mutex logMutex;
 const std::string& getLogFileName() { return logFileName; }
 
 /**
@@ -1479,8 +1510,15 @@ const std::string& getLogFileName() { return logFileName; }
  */
 void setLogFileName(const std::string& name) {
 	deleteFile(name);
-	size_t sz = logBuffer.size();
-	Log(LOG_DEBUG) << "setLogFileName("<<name<<") was '"<<logFileName<<"'; "<<sz<<" in buffer";
+	size_t sz;
+	std::string oldName;
+	{
+		std::lock_guard<std::mutex> lock(logMutex);
+		sz = logBuffer.size();
+		oldName = logFileName;
+	}
+	Log(LOG_DEBUG) << "setLogFileName("<<name<<") was '"<<oldName<<"'; "<<sz<<" in buffer";
+	std::lock_guard<std::mutex> lock(logMutex);
 	logFileName = name;
 }
 void log(int level, const std::ostringstream& baremsgstream) {
@@ -1490,6 +1528,7 @@ void log(int level, const std::ostringstream& baremsgstream) {
 			  << baremsgstream.str() << std::endl;
 	auto msg = msgstream.str();
 
+	std::lock_guard<std::mutex> lock(logMutex);
 	int effectiveLevel = Logger::reportingLevel();
 	if (effectiveLevel >= LOG_DEBUG) {
 		fwrite(msg.c_str(), msg.size(), 1, stderr);
@@ -28,8 +28,12 @@ namespace OpenXcom
 /**
  * Initializes the font with a blank surface.
  */
-Font::Font() : _monospace(false)
+Font::Font() : _latinChars(256), _unknownChar(0), _monospace(false)
 {
+	_blankChar.image = 0;
+	_blankChar.rect.x = _blankChar.rect.y = _blankChar.rect.w = _blankChar.rect.h = 0;
+	_blankChar.width = _blankChar.height = 0;
+	_unknownChar = &_blankChar;
 }
 
 /**
@@ -117,7 +121,11 @@ void Font::init(size_t index, const UString &str)
 			rect.y = startY;
 			rect.w = image->width;
 			rect.h = image->height;
-			_chars[str[i]] = std::make_pair(index, rect);
+			FontChar &chr = _chars[str[i]];
+			chr.image = index;
+			chr.rect = rect;
+			chr.width = rect.w + image->spacing;
+			chr.height = rect.h + image->spacing;
 		}
 	}
 	else
@@ -155,10 +163,51 @@ void Font::init(size_t index, const UString &str)
 			rect.w = right - left + 1;
 			rect.h = image->height;
 
-			_chars[str[i]] = std::make_pair(index, rect);
+			FontChar &chr = _chars[str[i]];
+			chr.image = index;
+			chr.rect = rect;
+			chr.width = rect.w + image->spacing;
+			chr.height = rect.h + image->spacing;
 		}
 	}
 	surface->unlock();
+
+	// Elements of an unordered_map stay put when it grows, so these can point right at them
+	for (std::unordered_map<UCode, FontChar>::const_iterator i = _chars.begin(); i != _chars.end(); ++i)
+	{
+		if (i->first < _latinChars.size())
+		{
+			_latinChars[i->first] = &i->second;
+		}
+	}
+	if (_latinChars['?'])
+	{
+		_unknownChar = _latinChars['?'];
+	}
+	else
+	{
+		_blankChar.width = _blankChar.height = _images[0].spacing;
+	}
+}
+
+/**
+ * Finds the character to draw for a codepoint,
+ * or a question mark if the font doesn't have it.
+ * @param c Codepoint.
+ * @return Pointer to the character.
+ */
+const Font::FontChar *Font::findChar(UCode c) const
+{
+	if (c < _latinChars.size())
+	{
+		return _latinChars[c] ? _latinChars[c] : _unknownChar;
+	}
+	std::unordered_map<UCode, FontChar>::const_iterator i = _chars.find(c);
+	if (i != _chars.end())
+	{
+		return &i->second;
+	}
+	return _unknownChar;
 }
 
 /**
@@ -169,10 +218,9 @@ void Font::init(size_t index, const UString &str)
  */
 SurfaceCrop Font::getChar(UCode c)
 {
-	if (_chars.find(c) == _chars.end())
-		c = '?';
-	auto surfaceCrop = _images[_chars[c].first].surface->getCrop();
-	*surfaceCrop.getCrop() = _chars[c].second;
+	const FontChar *chr = findChar(c);
+	auto surfaceCrop = _images[chr->image].surface->getCrop();
+	*surfaceCrop.getCrop() = chr->rect;
 	return surfaceCrop;
 }
 
@@ -215,12 +263,9 @@ SDL_Rect Font::getCharSize(UCode c)
 	SDL_Rect size = { 0, 0, 0, 0 };
 	if (Unicode::isPrintable(c))
 	{
-		if (_chars.find(c) == _chars.end())
-			c = '?';
-
-		FontImage *image = &_images[_chars[c].first];
-		size.w = _chars[c].second.w + image->spacing;
-		size.h = _chars[c].second.h + image->spacing;
+		const FontChar *chr = findChar(c);
+		size.w = chr->width;
+		size.h = chr->height;
 	}
 	else
 	{
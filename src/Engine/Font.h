@@ -18,6 +18,7 @@
  * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <utility>
 #include <string>
@@ -48,11 +49,25 @@ struct FontImage
 class Font
 {
 private:
+	/// Where a character is in the font images and how much room it takes.
+	struct FontChar
+	{
+		size_t image;
+		SDL_Rect rect;
+		int width, height;
+	};
 	std::vector<FontImage> _images;
-	std::map< UCode, std::pair<size_t, SDL_Rect> > _chars;
+	std::unordered_map<UCode, FontChar> _chars;
+	/// Characters of the first codepoints, looked up directly since most text uses them.
+	std::vector<const FontChar*> _latinChars;
+	/// Character used in place of the ones missing from the font.
+	const FontChar *_unknownChar;
+	FontChar _blankChar;
 	bool _monospace;
 	/// Determines the size and position of each character in the font.
 	void init(size_t index, const UString &str);
+	/// Gets the character to draw for a codepoint.
+	const FontChar *findChar(UCode c) const;
 public:
 
 	/// Creates a blank font.
@@ -24,6 +24,7 @@
 #include <SDL_mixer.h>
 #include "State.h"
 #include "Screen.h"
+#include "Surface.h"
 #include "Sound.h"
 #include "Music.h"
 #include "Language.h"
@@ -151,6 +152,13 @@ void Game::run()
 			_deleted.pop_back();
 		}
 
+		// Report surface buffers needed by the last frame
+		Surface::BufferCounts buffers = Surface::takeBufferCounts();
+		if (buffers.allocated + buffers.reused > 0)
+		{
+			Log(LOG_VERBOSE) << "Surface buffers: " << buffers.allocated << " allocated, " << buffers.reused << " reused";
+		}
+
 		// Initialize active state
 		if (!_init)
 		{
@@ -336,6 +344,11 @@ void Game::run()
 		}
 	}
 
+	std::string pending = SavedGame::waitForBackgroundSave();
+	if (!pending.empty())
+	{
+		Log(LOG_ERROR) << pending;
+	}
 	Options::save();
 }
 
@@ -156,6 +156,7 @@ void Language::loadFile(const FileMap::FileRecord *frec)
 {
 	YAML::Node doc = frec->getYAML();
 	YAML::Node lang;
+	_pluralForms.clear();
 	if (doc.begin()->second.IsMap())
 	{
 		_id = doc.begin()->first.as<std::string>();
@@ -221,6 +222,7 @@ void Language::loadFile(const FileMap::FileRecord *frec)
 void Language::loadRule(const std::map<std::string, ExtraStrings*> &extraStrings, const std::string &id)
 {
 	std::map<std::string, ExtraStrings*>::const_iterator it = extraStrings.find(id);
+	_pluralForms.clear();
 	if (it != extraStrings.end())
 	{
 		ExtraStrings *extras = it->second;
@@ -299,24 +301,9 @@ LocalizedText Language::getString(const std::string &id, unsigned n) const
 {
 	assert(!id.empty());
 	static std::set<std::string> notFoundIds;
-	std::map<std::string, LocalizedText>::const_iterator s = _strings.end();
-	// Try specialized form.
-	if (n == 0)
-	{
-		s = _strings.find(id + "_zero");
-	}
-	// Try proper form by language
-	if (s == _strings.end())
-	{
-		s = _strings.find(id + _handler->getSuffix(n));
-	}
-	// Try default form
-	if (s == _strings.end())
-	{
-		s = _strings.find(id + "_other");
-	}
+	const LocalizedText *form = getPluralForm(id, n);
 	// Give up
-	if (s == _strings.end())
+	if (form == 0)
 	{
 		if (notFoundIds.end() == notFoundIds.find(id))
 		{
@@ -333,19 +320,59 @@ LocalizedText Language::getString(const std::string &id, unsigned n) const
 			Log(LOG_WARNING) << id << " has plural format in ``" << Options::language << "``. Code assumes singular format.";
 //		Hint: Change ``getstring(ID).arg(value)`` to ``getString(ID, value)`` in appropriate files.
 		}
-		return s->second;
+		return *form;
 	}
 	else
 	{
-		std::ostringstream ss;
-		ss << n;
-		std::string marker("{N}"), val(ss.str()), txt(s->second);
-		Unicode::replace(txt, marker, val);
+		std::string txt(*form);
+		Unicode::replace(txt, "{N}", std::to_string(n));
 		return txt;
 	}
 
 }
 
+/**
+ * Finds the plural form of a string to use for @a n.
+ * The lookups only depend on the plural suffix, so the result for each
+ * ID and suffix is remembered instead of building the keys every time.
+ * @param id ID of the string.
+ * @param n Number to use to decide the proper form.
+ * @return The string in the proper form, or 0 if there's none.
+ */
+const LocalizedText *Language::getPluralForm(const std::string &id, unsigned n) const
+{
+	static const char zeroSuffix[] = "_zero";
+	const char *suffix = (n == 0) ? zeroSuffix : _handler->getSuffix(n);
+	std::vector<std::pair<const char*, const LocalizedText*> > &forms = _pluralForms[id];
+	for (std::vector<std::pair<const char*, const LocalizedText*> >::const_iterator i = forms.begin(); i != forms.end(); ++i)
+	{
+		if (i->first == suffix)
+		{
+			return i->second;
+		}
+	}
+
+	std::map<std::string, LocalizedText>::const_iterator s = _strings.end();
+	// Try specialized form.
+	if (n == 0)
+	{
+		s = _strings.find(id + zeroSuffix);
+	}
+	// Try proper form by language
+	if (s == _strings.end())
+	{
+		s = _strings.find(id + _handler->getSuffix(n));
+	}
+	// Try default form
+	if (s == _strings.end())
+	{
+		s = _strings.find(id + "_other");
+	}
+	const LocalizedText *form = (s == _strings.end()) ? 0 : &s->second;
+	forms.push_back(std::make_pair(suffix, form));
+	return form;
+}
+
 /**
  * Returns the localized text with the specified ID, in the proper form for the gender.
  * If it's not found, just returns the ID.
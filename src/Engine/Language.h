@@ -18,6 +18,7 @@
  * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include "LocalizedText.h"
@@ -42,6 +43,7 @@ class Language
 private:
 	std::string _id;
 	std::map<std::string, LocalizedText> _strings;
+	mutable std::unordered_map<std::string, std::vector<std::pair<const char*, const LocalizedText*> > > _pluralForms;
 	LanguagePlurality *_handler;
 	TextDirection _direction;
 	TextWrapping _wrap;
@@ -51,6 +53,8 @@ private:
 
 	/// Parses a text string loaded from an external file.
 	std::string loadString(const std::string &s) const;
+	/// Finds the plural form of a string for a quantity.
+	const LocalizedText *getPluralForm(const std::string &id, unsigned n) const;
 public:
 	/// Creates a blank language.
 	Language();
@@ -18,10 +18,40 @@
  */
 #include "LocalizedText.h"
 #include "Language.h"
+#include <cstdio>
 
 namespace OpenXcom
 {
 
+/**
+ * Copies @a text to @a out, replacing every {id} marker with @a val.
+ * The text is scanned only once, and nothing is copied if there's no marker.
+ * @param text The text to scan.
+ * @param id The argument ID of the marker.
+ * @param val The value to place in the markers' positions.
+ * @param out The text with the markers replaced.
+ * @return If any marker was found.
+ */
+bool LocalizedText::substitute(const std::string &text, unsigned id, const std::string &val, std::string &out)
+{
+	char marker[16];
+	int markerLen = snprintf(marker, sizeof(marker), "{%u}", id);
+	size_t pos = text.find(marker, 0, markerLen);
+	if (std::string::npos == pos)
+		return false;
+	out.clear();
+	out.reserve(text.size() + val.size());
+	size_t last = 0;
+	for (/*empty*/ ; std::string::npos != pos; pos = text.find(marker, last, markerLen))
+	{
+		out.append(text, last, pos - last);
+		out.append(val);
+		last = pos + markerLen;
+	}
+	out.append(text, last, std::string::npos);
+	return true;
+}
+
 /**
  * Replace the next argument placeholder with @a val.
  * @param val The value to place in the next placeholder's position.
@@ -29,17 +59,9 @@ namespace OpenXcom
  */
 LocalizedText LocalizedText::arg(const std::string &val) const
 {
-	std::ostringstream os;
-	os << '{' << _nextArg << '}';
-	std::string marker(os.str());
-	size_t pos = _text.find(marker);
-	if (std::string::npos == pos)
+	std::string ntext;
+	if (!substitute(_text, _nextArg, val, ntext))
 		return *this;
-	std::string ntext(_text);
-	for (/*empty*/ ; std::string::npos != pos; pos = ntext.find(marker, pos + val.length()))
-	{
-		ntext.replace(pos, marker.length(), val);
-	}
 	return LocalizedText(ntext, _nextArg);
 }
 
@@ -50,16 +72,10 @@ LocalizedText LocalizedText::arg(const std::string &val) const
  */
 LocalizedText &LocalizedText::arg(const std::string &val)
 {
-	std::ostringstream os;
-	os << '{' << _nextArg << '}';
-	std::string marker(os.str());
-	size_t pos = _text.find(marker);
-	if (std::string::npos != pos)
+	std::string ntext;
+	if (substitute(_text, _nextArg, val, ntext))
 	{
-		for (/*empty*/ ; std::string::npos != pos; pos = _text.find(marker, pos + val.length()))
-		{
-			_text.replace(pos, marker.length(), val);
-		}
+		_text.swap(ntext);
 		++_nextArg;
 	}
 	return *this;
@@ -62,6 +62,8 @@ private:
 	std::string _text; ///< The actual localized text.
 	unsigned _nextArg; ///< The next argument ID.
 	LocalizedText(const std::string &, unsigned);
+	/// Replace all markers of an argument in a single pass.
+	static bool substitute(const std::string &text, unsigned id, const std::string &val, std::string &out);
 };
 
 /**
@@ -101,20 +103,8 @@ template <typename T>
 LocalizedText LocalizedText::arg(T val) const
 {
 	std::ostringstream os;
-	os << '{' << _nextArg << '}';
-	std::string marker(os.str());
-	size_t pos = _text.find(marker);
-	if (std::string::npos == pos)
-		return *this;
-	std::string ntext(_text);
-	os.str("");
 	os << val;
-	std::string tval(os.str());
-	for (/*empty*/ ; std::string::npos != pos; pos = ntext.find(marker, pos + tval.length()))
-	{
-		ntext.replace(pos, marker.length(), tval);
-	}
-	return LocalizedText(ntext, _nextArg);
+	return arg(os.str());
 }
 
 /**
@@ -127,21 +117,8 @@ template <typename T>
 LocalizedText &LocalizedText::arg(T val)
 {
 	std::ostringstream os;
-	os << '{' << _nextArg << '}';
-	std::string marker(os.str());
-	size_t pos = _text.find(marker);
-	if (std::string::npos != pos)
-	{
-		os.str("");
-		os << val;
-		std::string tval(os.str());
-		for (/*empty*/ ; std::string::npos != pos; pos = _text.find(marker, pos + tval.length()))
-		{
-			_text.replace(pos, marker.length(), tval);
-		}
-		++_nextArg;
-	}
-	return *this;
+	os << val;
+	return arg(os.str());
 }
 
 /// Allow streaming of LocalizedText objects.
@@ -0,0 +1,121 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <vector>
+#include <cmath>
+#include "../fmath.h"
+
+namespace OpenXcom
+{
+
+/**
+ * Coarse longitude/latitude grid over the globe.
+ * Each cell holds the items whose bounds overlap it,
+ * so point lookups only need to test a handful of
+ * candidates instead of every item on the globe.
+ * Items are kept in insertion order inside each cell.
+ */
+template<typename T>
+class LonLatGrid
+{
+public:
+	/// Number of cells around the equator (5 degrees each).
+	static constexpr int LON_CELLS = 72;
+	/// Number of cells from pole to pole (5 degrees each).
+	static constexpr int LAT_CELLS = 36;
+
+private:
+	std::vector<std::vector<T*> > _cells;
+
+	/// Gets the column of a longitude, wrapping around.
+	static int lonCell(double lon)
+	{
+		lon = std::fmod(lon, 2 * M_PI);
+		if (lon < 0)
+			lon += 2 * M_PI;
+		int cell = (int)(lon * LON_CELLS / (2 * M_PI));
+		return Clamp(cell, 0, LON_CELLS - 1);
+	}
+	/// Gets the row of a latitude.
+	static int latCell(double lat)
+	{
+		int cell = (int)std::floor((lat + M_PI_2) * LAT_CELLS / M_PI);
+		return Clamp(cell, 0, LAT_CELLS - 1);
+	}
+
+public:
+	/// Creates an empty grid.
+	LonLatGrid() : _cells(LON_CELLS * LAT_CELLS)
+	{
+	}
+
+	/// Removes all items from the grid.
+	void clear()
+	{
+		for (auto &cell : _cells)
+		{
+			cell.clear();
+		}
+	}
+
+	/**
+	 * Adds an item covering a longitude/latitude box.
+	 * @param item Item to add.
+	 * @param lonMin Western bound, can be bigger than lonMax if the box wraps around.
+	 * @param lonMax Eastern bound.
+	 * @param latMin Southern bound.
+	 * @param latMax Northern bound.
+	 * @param allLon Ignore the longitude bounds and cover the whole latitude band.
+	 */
+	void insert(T *item, double lonMin, double lonMax, double latMin, double latMax, bool allLon = false)
+	{
+		double span = lonMax - lonMin;
+		if (span < 0)
+			span += 2 * M_PI;
+		if (span >= 2 * M_PI * (LON_CELLS - 1) / LON_CELLS)
+			allLon = true;
+		int x1 = lonCell(lonMin), x2 = lonCell(lonMax);
+		int y1 = latCell(latMin), y2 = latCell(latMax);
+		int width = allLon ? LON_CELLS : (x2 - x1 + LON_CELLS) % LON_CELLS + 1;
+		for (int y = y1; y <= y2; ++y)
+		{
+			for (int i = 0; i < width; ++i)
+			{
+				std::vector<T*> &cell = _cells[y * LON_CELLS + (x1 + i) % LON_CELLS];
+				if (cell.empty() || cell.back() != item)
+				{
+					cell.push_back(item);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Gets the items whose bounds overlap the cell containing a point.
+	 * @param lon Longitude of the point.
+	 * @param lat Latitude of the point.
+	 * @return List of candidate items.
+	 */
+	const std::vector<T*> &get(double lon, double lat) const
+	{
+		return _cells[latCell(lat) * LON_CELLS + lonCell(lon)];
+	}
+};
+
+}
@@ -25,10 +25,20 @@
 #include "SDL2Helpers.h"
 #include "Adlib/adlplayer.h"
 #include "AdlibMusic.h"
+#include <algorithm>
+#include <deque>
 
 namespace OpenXcom
 {
 
+namespace
+{
+
+/// On demand tracks currently loaded, least recently played first.
+std::deque<const Music*> onDemandLoaded;
+
+}
+
 /**
  * Initializes a new music track.
  */
@@ -43,8 +53,21 @@ Music::~Music()
 {
 #ifndef __NO_MUSIC
 	stop();
-	if (_music)	Mix_FreeMusic(_music);
+	unload();
+	onDemandLoaded.erase(std::remove(onDemandLoaded.begin(), onDemandLoaded.end(), this), onDemandLoaded.end());
+#endif
+}
+
+/**
+ * Frees the loaded music content, if any.
+ */
+void Music::unload() const
+{
+#ifndef __NO_MUSIC
+	if (_music) Mix_FreeMusic(_music);
 	if (_rwops) SDL_RWclose(_rwops);
+	_music = 0;
+	_rwops = 0;
 #endif
 }
 
@@ -77,6 +100,51 @@ void Music::load(SDL_RWops *rwops)
 #endif
 }
 
+/**
+ * Sets up the music to be loaded from a file only when it's first
+ * played, instead of keeping every track open from startup.
+ * Only a few of these tracks stay loaded at once, the least
+ * recently played ones are freed again to make room.
+ * @param filename Filename of the music file.
+ */
+void Music::setOnDemandFile(const std::string &filename)
+{
+	_onDemandFile = filename;
+}
+
+/**
+ * Loads the on demand music file, if it isn't loaded yet,
+ * and marks it as the most recently played track.
+ */
+void Music::loadOnDemand() const
+{
+#ifndef __NO_MUSIC
+	if (_onDemandFile.empty())
+	{
+		return;
+	}
+	onDemandLoaded.erase(std::remove(onDemandLoaded.begin(), onDemandLoaded.end(), this), onDemandLoaded.end());
+	if (_music == 0)
+	{
+		_rwops = FileMap::getRWops(_onDemandFile);
+		_music = _rwops ? Mix_LoadMUS_RW(_rwops) : 0;
+		if (_music == 0)
+		{
+			Log(LOG_WARNING) << "Music::loadOnDemand('" << _onDemandFile << "'): " << Mix_GetError();
+			unload();
+			return;
+		}
+		Log(LOG_VERBOSE) << "Music::loadOnDemand('" << _onDemandFile << "')";
+	}
+	onDemandLoaded.push_back(this);
+	while (onDemandLoaded.size() > MAX_ON_DEMAND_LOADED)
+	{
+		onDemandLoaded.front()->unload();
+		onDemandLoaded.pop_front();
+	}
+#endif
+}
+
 /**
  * Plays the contained music track.
  * @param loop Amount of times to loop the track. -1 = infinite
@@ -86,6 +154,12 @@ void Music::play(int loop) const
 #ifndef __NO_MUSIC
 	if (!Options::mute)
 	{
+		if (!_onDemandFile.empty())
+		{
+			// make sure the track we free isn't the one playing
+			stop();
+			loadOnDemand();
+		}
 		if (_music != 0)
 		{
 			stop();
@@ -30,9 +30,18 @@ namespace OpenXcom
 class Music
 {
 private:
-	Mix_Music *_music;
-	SDL_RWops *_rwops;
+	mutable Mix_Music *_music;
+	mutable SDL_RWops *_rwops;
+	std::string _onDemandFile;
+
+	/// Loads the music file set up for on demand loading.
+	void loadOnDemand() const;
+	/// Frees the loaded music content.
+	void unload() const;
 public:
+	/// Maximum number of on demand tracks kept loaded at once.
+	static const size_t MAX_ON_DEMAND_LOADED = 4;
+
 	/// Creates a blank music track.
 	Music();
 	/// Cleans up the music track.
@@ -41,6 +50,8 @@ public:
 	virtual void load(const std::string &filename);
 	/// Loads music from the specified rwops.
 	virtual void load(SDL_RWops *rwops);
+	/// Sets up music to load from the specified file when first played.
+	void setOnDemandFile(const std::string &filename);
 	/// Plays the music.
 	virtual void play(int loop = -1) const;
 	/// Stops all music.
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "PaletteMatcher.h"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include "../fmath.h"
+
+namespace OpenXcom
+{
+
+/**
+ * Sorts the colors of a palette into the RGB grid.
+ * @param colors Palette colors.
+ * @param ncolors Number of colors, at most 256.
+ */
+PaletteMatcher::PaletteMatcher(const SDL_Color *colors, int ncolors) : _colors(colors, colors + std::min(ncolors, 256)), _cells(CELLS * CELLS * CELLS)
+{
+	for (size_t i = 0; i < _colors.size(); ++i)
+	{
+		const SDL_Color &c = _colors[i];
+		_cells[((c.r >> CELL_BITS) * CELLS + (c.g >> CELL_BITS)) * CELLS + (c.b >> CELL_BITS)].push_back((Uint8)i);
+	}
+}
+
+/**
+ * Returns the palette color closest to a color, by squared RGB distance.
+ * Cells are searched in growing shells around the color's cell,
+ * until no further shell can hold anything closer.
+ * @param r Red component (0-255).
+ * @param g Green component (0-255).
+ * @param b Blue component (0-255).
+ * @return Index of the closest palette color.
+ */
+Uint8 PaletteMatcher::findNearest(int r, int g, int b) const
+{
+	const int cr = Clamp(r, 0, 255) >> CELL_BITS;
+	const int cg = Clamp(g, 0, 255) >> CELL_BITS;
+	const int cb = Clamp(b, 0, 255) >> CELL_BITS;
+	int best = INT_MAX;
+	int closest = 0;
+
+	for (int shell = 0; shell < CELLS; ++shell)
+	{
+		// every color in this shell is at least this far along one channel
+		const int gap = (shell - 1) << CELL_BITS;
+		if (shell > 0 && gap * gap > best)
+		{
+			break;
+		}
+		for (int x = std::max(cr - shell, 0); x <= std::min(cr + shell, CELLS - 1); ++x)
+		{
+			for (int y = std::max(cg - shell, 0); y <= std::min(cg + shell, CELLS - 1); ++y)
+			{
+				for (int z = std::max(cb - shell, 0); z <= std::min(cb + shell, CELLS - 1); ++z)
+				{
+					if (std::max(std::max(std::abs(x - cr), std::abs(y - cg)), std::abs(z - cb)) != shell)
+					{
+						continue;
+					}
+					const std::vector<Uint8> &cell = _cells[(x * CELLS + y) * CELLS + z];
+					for (std::vector<Uint8>::const_iterator i = cell.begin(); i != cell.end(); ++i)
+					{
+						const SDL_Color &c = _colors[*i];
+						int difference = (r - c.r) * (r - c.r) + (g - c.g) * (g - c.g) + (b - c.b) * (b - c.b);
+						if (difference < best || (difference == best && *i < closest))
+						{
+							closest = *i;
+							best = difference;
+						}
+					}
+				}
+			}
+		}
+	}
+	return closest;
+}
+
+}
@@ -0,0 +1,50 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <vector>
+#include <SDL.h>
+
+namespace OpenXcom
+{
+
+/**
+ * Finds the palette colors closest to arbitrary RGB colors.
+ * The palette is sorted into a coarse RGB grid, so a query only
+ * looks at the colors in the cells around it instead of the whole
+ * palette. Gives the same results as a linear search: the lowest
+ * index among the colors at the smallest squared distance.
+ */
+class PaletteMatcher
+{
+private:
+	/// Each grid cell covers this many bits of each channel.
+	static const int CELL_BITS = 5;
+	/// Number of cells along each channel.
+	static const int CELLS = 256 >> CELL_BITS;
+
+	std::vector<SDL_Color> _colors;
+	std::vector<std::vector<Uint8> > _cells;
+public:
+	/// Sorts a palette into the grid.
+	PaletteMatcher(const SDL_Color *colors, int ncolors);
+	/// Gets the palette index closest to a color.
+	Uint8 findNearest(int r, int g, int b) const;
+};
+
+}
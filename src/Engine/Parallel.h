@@ -0,0 +1,88 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace OpenXcom
+{
+
+/**
+ * Runs a job for every index from 0 to count - 1 on a small pool
+ * of worker threads, and waits until all of them are done.
+ * Jobs can run in any order, so each one must only touch its own data.
+ * If any job throws, the exception of the lowest index is rethrown
+ * once every worker has finished.
+ * @param count Number of jobs.
+ * @param func Job to run, called with the job index.
+ */
+template<typename F>
+void parallelFor(size_t count, F func)
+{
+	std::atomic<size_t> next(0);
+	std::vector<std::exception_ptr> errors(count);
+	auto worker = [&]
+	{
+		for (size_t i = next++; i < count; i = next++)
+		{
+			try
+			{
+				func(i);
+			}
+			catch (...)
+			{
+				errors[i] = std::current_exception();
+			}
+		}
+	};
+
+	size_t threads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), count);
+	std::vector<std::thread> pool;
+	for (size_t i = 1; i < threads; ++i)
+	{
+		try
+		{
+			pool.emplace_back(worker);
+		}
+		catch (std::system_error &)
+		{
+			// no more threads available, make do with what we have
+			break;
+		}
+	}
+	worker();
+	for (auto &t : pool)
+	{
+		t.join();
+	}
+
+	for (auto &e : errors)
+	{
+		if (e)
+		{
+			std::rethrow_exception(e);
+		}
+	}
+}
+
+}
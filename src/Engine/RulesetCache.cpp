@@ -0,0 +1,138 @@
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "RulesetCache.h"
+#include <algorithm>
+#include <vector>
+#include <SDL.h>
+#include "SDL2Helpers.h"
+#include "CrossPlatform.h"
+#include "Exception.h"
+#include "Logger.h"
+#include "YamlBinary.h"
+
+namespace OpenXcom
+{
+
+namespace RulesetCache
+{
+
+namespace
+{
+
+/// Identifies the cache file.
+const char CacheMagic[4] = { 'O', 'X', 'R', 'C' };
+/// Bump whenever the encoding changes.
+const Uint32 CacheVersion = 1;
+
+}
+
+/**
+ * Hashes the text of a ruleset file (64-bit FNV-1a).
+ * @param text File contents.
+ * @return Hash of the text.
+ */
+Uint64 hash(const std::string &text)
+{
+	Uint64 h = 14695981039346656037ULL;
+	for (unsigned char c : text)
+	{
+		h ^= c;
+		h *= 1099511628211ULL;
+	}
+	return h ^ text.size();
+}
+
+/**
+ * Reads all the cached documents from a cache file.
+ * A missing, outdated or damaged file just gives an empty cache.
+ * @param filename Full path of the cache file.
+ * @return Cached documents by ruleset path.
+ */
+Entries load(const std::string &filename)
+{
+	Entries entries;
+	if (!CrossPlatform::fileExists(filename))
+	{
+		return entries;
+	}
+	SDL_RWops *rwops = SDL_RWFromFile(filename.c_str(), "rb");
+	if (!rwops)
+	{
+		return entries;
+	}
+	size_t size = 0;
+	char *data = (char *)SDL_LoadFile_RW(rwops, &size, SDL_TRUE);
+	if (!data)
+	{
+		return entries;
+	}
+
+	try
+	{
+		YamlBinary::Reader in = { data, data + size };
+		in.need(sizeof(CacheMagic));
+		if (!std::equal(CacheMagic, CacheMagic + sizeof(CacheMagic), in.pos))
+		{
+			throw Exception("Ruleset cache has a wrong signature");
+		}
+		in.pos += sizeof(CacheMagic);
+		if (in.number() != CacheVersion)
+		{
+			throw Exception("Ruleset cache has a different version");
+		}
+		for (Uint64 i = in.number(); i > 0; --i)
+		{
+			std::string path = in.string();
+			Entry &entry = entries[path];
+			entry.hash = in.fixed64();
+			entry.data = in.string();
+		}
+	}
+	catch (Exception &e)
+	{
+		Log(LOG_INFO) << filename << ": " << e.what() << ", ignoring it.";
+		entries.clear();
+	}
+	SDL_free(data);
+	return entries;
+}
+
+/**
+ * Writes all the cached documents to a cache file.
+ * @param filename Full path of the cache file.
+ * @param entries Cached documents by ruleset path.
+ * @return If the file was written.
+ */
+bool save(const std::string &filename, const Entries &entries)
+{
+	std::string out(CacheMagic, sizeof(CacheMagic));
+	YamlBinary::writeNumber(out, CacheVersion);
+	YamlBinary::writeNumber(out, entries.size());
+	for (Entries::const_iterator i = entries.begin(); i != entries.end(); ++i)
+	{
+		YamlBinary::writeString(out, i->first);
+		YamlBinary::writeFixed64(out, i->second.hash);
+		YamlBinary::writeString(out, i->second.data);
+	}
+	return CrossPlatform::writeFile(filename, std::vector<unsigned char>(out.begin(), out.end()));
+}
+
+}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string>
+#include <unordered_map>
+#include <SDL_types.h>
+
+namespace OpenXcom
+{
+
+/**
+ * Binary cache of parsed ruleset documents.
+ * Parsing YAML text is slow, so the parsed trees are stored
+ * in the YamlBinary form, keyed by the path and a hash of
+ * the text of each ruleset file, and rebuilt from there when
+ * the file didn't change since the last time.
+ */
+namespace RulesetCache
+{
+	/// Cached document of a ruleset file.
+	struct Entry
+	{
+		/// Hash of the text the document was parsed from.
+		Uint64 hash = 0;
+		/// Encoded document.
+		std::string data;
+	};
+	/// Cached documents by file path.
+	typedef std::unordered_map<std::string, Entry> Entries;
+
+	/// Hashes the text of a ruleset file.
+	Uint64 hash(const std::string &text);
+	/// Reads all cached documents from a file.
+	Entries load(const std::string &filename);
+	/// Writes all cached documents to a file.
+	bool save(const std::string &filename, const Entries &entries);
+}
+
+}
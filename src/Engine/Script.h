@@ -432,6 +432,27 @@ public:
 		return true;
 	}
 
+	/// Test if neither the script nor any global event script would run.
+	bool empty() const
+	{
+		if (_current)
+		{
+			return false;
+		}
+		// events are stored as: before events, empty, after events, empty
+		auto ptr = _events;
+		if (ptr == nullptr)
+		{
+			return true;
+		}
+		if (*ptr)
+		{
+			return false;
+		}
+		++ptr;
+		return !*ptr;
+	}
+
 	/// Get pointer to proc data.
 	const Uint8* data() const
 	{
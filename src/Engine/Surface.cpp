@@ -32,6 +32,10 @@
 #include <stdlib.h>
 #include "SDL2Helpers.h"
 #include "FileMap.h"
+#include "CrossPlatform.h"
+#include "Parallel.h"
+#include <unordered_map>
+#include <mutex>
 #ifdef _WIN32
 #include <malloc.h>
 #endif
@@ -104,19 +108,76 @@ inline void FixTransparent(const Surface::UniqueSurfacePtr& dest, int currentTra
 	}
 }
 
-} //namespace
+/**
+ * PNG image decoded ahead of time.
+ */
+struct PreloadedImage
+{
+	std::vector<unsigned char> png, image;
+	std::vector<SDL_Color> palette;
+	unsigned width = 0, height = 0;
+	bool valid = false;
+};
+
+/// Images decoded by Surface::preloadImages, waiting to be loaded.
+std::unordered_map<std::string, PreloadedImage> preloadedImages;
+
+/// Bytes kept in front of each surface buffer, keeps the 16 byte alignment.
+const size_t BufferHeader = 16;
+/// Smallest size class of pooled buffers (64 bytes).
+const int MinBufferClass = 6;
+/// Largest size class of pooled buffers (4 MB), bigger ones are freed right away.
+const int MaxBufferClass = 22;
+/// Most bytes kept in the free lists at any time.
+const size_t MaxPooledBytes = 16 * 1024 * 1024;
 
 /**
- * Helper function creating aligned buffer
- * @param bpp bits per pixel
- * @param width number of pixel in row
- * @param height number of rows
- * @return pointer to memory
+ * Free lists of surface buffers by size class.
+ * States build all their surfaces again each time they are opened,
+ * so the buffers of deleted surfaces are kept around to be reused
+ * by the next ones of a similar size instead of going back to the heap.
  */
-Surface::UniqueBufferPtr Surface::NewAlignedBuffer(int bpp, int width, int height)
+struct BufferPool
+{
+	std::mutex mutex;
+	std::vector<Uint8*> free[MaxBufferClass + 1];
+	size_t pooledBytes = 0;
+	Surface::BufferCounts counts;
+};
+
+/**
+ * Gets the buffer pool. It's never destroyed, so surfaces
+ * can still be deleted safely during static destruction.
+ * @return The buffer pool.
+ */
+BufferPool &getBufferPool()
+{
+	static BufferPool *pool = new BufferPool();
+	return *pool;
+}
+
+/**
+ * Gets the size class needed to hold a buffer.
+ * @param total Size of the buffer in bytes.
+ * @return Size class, or -1 if it's too big to be pooled.
+ */
+int getBufferClass(size_t total)
+{
+	int sizeClass = MinBufferClass;
+	while (((size_t)1 << sizeClass) < total)
+	{
+		++sizeClass;
+	}
+	return sizeClass <= MaxBufferClass ? sizeClass : -1;
+}
+
+/**
+ * Allocates aligned memory from the heap.
+ * @param total Size in bytes.
+ * @return Pointer to the memory.
+ */
+Uint8 *allocAligned(size_t total)
 {
-	const int pitch = GetPitch(bpp, width);
-	const int total = pitch * height;
 	void* buffer = 0;
 
 #ifndef _WIN32
@@ -148,8 +209,62 @@ Surface::UniqueBufferPtr Surface::NewAlignedBuffer(int bpp, int width, int heigh
 
 #endif
 
+	return (Uint8*)buffer;
+}
+
+/**
+ * Returns aligned memory to the heap.
+ * @param buffer Pointer to the memory.
+ */
+void freeAligned(Uint8 *buffer)
+{
+#ifdef _WIN32
+	_aligned_free(buffer);
+#else
+	free(buffer);
+#endif
+}
+
+} //namespace
+
+/**
+ * Helper function creating aligned buffer
+ * @param bpp bits per pixel
+ * @param width number of pixel in row
+ * @param height number of rows
+ * @return pointer to memory
+ */
+Surface::UniqueBufferPtr Surface::NewAlignedBuffer(int bpp, int width, int height)
+{
+	const int pitch = GetPitch(bpp, width);
+	const size_t total = pitch * height;
+	const int sizeClass = getBufferClass(total);
+	Uint8 *block = 0;
+
+	BufferPool &pool = getBufferPool();
+	{
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		if (sizeClass != -1 && !pool.free[sizeClass].empty())
+		{
+			block = pool.free[sizeClass].back();
+			pool.free[sizeClass].pop_back();
+			pool.pooledBytes -= (size_t)1 << sizeClass;
+			pool.counts.reused++;
+		}
+		else
+		{
+			pool.counts.allocated++;
+		}
+	}
+	if (!block)
+	{
+		block = allocAligned(BufferHeader + (sizeClass != -1 ? (size_t)1 << sizeClass : total));
+	}
+
+	*(int*)block = sizeClass;
+	Uint8 *buffer = block + BufferHeader;
 	memset(buffer, 0, total);
-	return Surface::UniqueBufferPtr((Uint8*)buffer);
+	return Surface::UniqueBufferPtr(buffer);
 }
 
 /**
@@ -208,14 +323,37 @@ void Surface::UniqueBufferDeleter::operator ()(Uint8* buffer)
 {
 	if (buffer)
 	{
-#ifdef _WIN32
-		_aligned_free(buffer);
-#else
-		free(buffer);
-#endif
+		Uint8 *block = buffer - BufferHeader;
+		const int sizeClass = *(int*)block;
+		if (sizeClass != -1)
+		{
+			BufferPool &pool = getBufferPool();
+			std::lock_guard<std::mutex> lock(pool.mutex);
+			if (pool.pooledBytes + ((size_t)1 << sizeClass) <= MaxPooledBytes)
+			{
+				pool.free[sizeClass].push_back(block);
+				pool.pooledBytes += (size_t)1 << sizeClass;
+				return;
+			}
+		}
+		freeAligned(block);
 	}
 }
 
+/**
+ * Gets how many surface buffers were allocated from the heap
+ * and reused from the pool since the last call, and resets the counters.
+ * @return Buffer counters.
+ */
+Surface::BufferCounts Surface::takeBufferCounts()
+{
+	BufferPool &pool = getBufferPool();
+	std::lock_guard<std::mutex> lock(pool.mutex);
+	BufferCounts counts = pool.counts;
+	pool.counts = BufferCounts();
+	return counts;
+}
+
 /**
  * Default deleter for SDL surface
  * @param surf
@@ -366,6 +504,18 @@ void Surface::loadImage(const std::string &filename)
 	_surface = nullptr;
 
 	Log(LOG_VERBOSE) << "Loading image: " << filename;
+	auto pre = preloadedImages.find(filename);
+	if (pre != preloadedImages.end())
+	{
+		PreloadedImage preloaded = std::move(pre->second);
+		preloadedImages.erase(pre);
+		if (preloaded.valid)
+		{
+			loadPngPixels(filename, preloaded.image, preloaded.width, preloaded.height, preloaded.palette.data(), (int)preloaded.palette.size());
+			return;
+		}
+	}
+
 	auto rw = FileMap::getRWops(filename);
 	if (!rw) { return; } // relevant message gets logged in FileMap.
 
@@ -391,32 +541,7 @@ void Surface::loadImage(const std::string &filename)
 				unsigned bpp = lodepng_get_bpp(color);
 				if (bpp == 8)
 				{
-					*this = Surface(width, height, 0, 0);
-					setPalette((SDL_Color*)color->palette, 0, color->palettesize);
-
-					ShaderDrawFunc(
-						[](Uint8& dest, unsigned char& src)
-						{
-							dest = src;
-						},
-						ShaderSurface(this),
-						ShaderSurface(SurfaceRaw<unsigned char>(image, width, height))
-					);
-					int transparent = 0;
-					for (int c = 0; c < _surface->format->palette->ncolors; ++c)
-					{
-						SDL_Color *palColor = _surface->format->palette->colors + c;
-						if (palColor->unused == 0)
-						{
-							transparent = c;
-							break;
-						}
-					}
-					FixTransparent(_surface, transparent);
-					if (transparent != 0)
-					{
-						Log(LOG_WARNING) << "Image " << filename << " (from lodepng) has incorrect transparent color index " << transparent << " (instead of 0).";
-					}
+					loadPngPixels(filename, image, width, height, (SDL_Color*)color->palette, color->palettesize);
 				}
 			} else {
 				Log(LOG_ERROR) << "Image " << filename << " lodepng failed:" << lodepng_error_text(error);
@@ -454,6 +579,109 @@ void Surface::loadImage(const std::string &filename)
 	}
 }
 
+/**
+ * Replaces the surface with the pixels and palette
+ * of an 8bpp image decoded by LodePNG.
+ * @param filename Filename of the image, for warnings.
+ * @param image Decoded palette indexes.
+ * @param width Width of the image.
+ * @param height Height of the image.
+ * @param palette Palette of the image.
+ * @param ncolors Number of colors in the palette.
+ */
+void Surface::loadPngPixels(const std::string &filename, std::vector<unsigned char> &image, unsigned width, unsigned height, const SDL_Color *palette, int ncolors)
+{
+	*this = Surface(width, height, 0, 0);
+	setPalette(palette, 0, ncolors);
+
+	ShaderDrawFunc(
+		[](Uint8& dest, unsigned char& src)
+		{
+			dest = src;
+		},
+		ShaderSurface(this),
+		ShaderSurface(SurfaceRaw<unsigned char>(image, width, height))
+	);
+	int transparent = 0;
+	for (int c = 0; c < _surface->format->palette->ncolors; ++c)
+	{
+		SDL_Color *palColor = _surface->format->palette->colors + c;
+		if (palColor->unused == 0)
+		{
+			transparent = c;
+			break;
+		}
+	}
+	FixTransparent(_surface, transparent);
+	if (transparent != 0)
+	{
+		Log(LOG_WARNING) << "Image " << filename << " (from lodepng) has incorrect transparent color index " << transparent << " (instead of 0).";
+	}
+}
+
+/**
+ * Decodes a batch of PNG images on worker threads, so the
+ * following loadImage calls for them only copy the pixels.
+ * Files are read one by one, since zipped mods can't be
+ * read concurrently. Anything that isn't a valid 8bpp PNG
+ * is left to loadImage to handle (and report) as usual.
+ * @param filenames Filenames of the images.
+ */
+void Surface::preloadImages(const std::vector<std::string> &filenames)
+{
+	clearPreloadedImages();
+
+	std::vector<PreloadedImage*> images;
+	for (const auto &filename : filenames)
+	{
+		if (!CrossPlatform::compareExt(filename, "png") || preloadedImages.count(filename) || !FileMap::fileExists(filename))
+		{
+			continue;
+		}
+		auto rw = FileMap::getRWops(filename);
+		if (!rw)
+		{
+			continue;
+		}
+		size_t size = 0;
+		void *data = SDL_LoadFile_RW(rw, &size, SDL_TRUE);
+		if (data)
+		{
+			PreloadedImage &preloaded = preloadedImages[filename];
+			preloaded.png.assign((unsigned char*)data, (unsigned char*)data + size);
+			images.push_back(&preloaded);
+			SDL_free(data);
+		}
+	}
+
+	parallelFor(images.size(), [&](size_t i)
+	{
+		PreloadedImage &preloaded = *images[i];
+		if (preloaded.png.size() > 8 + 12 + 12) // minimal PNG file size: header and two empty chunks
+		{
+			lodepng::State state;
+			state.decoder.color_convert = 0;
+			unsigned error = lodepng::decode(preloaded.image, preloaded.width, preloaded.height, state, preloaded.png);
+			const LodePNGColorMode *color = &state.info_png.color;
+			if (!error && lodepng_get_bpp(color) == 8)
+			{
+				const SDL_Color *palette = (const SDL_Color*)color->palette;
+				preloaded.palette.assign(palette, palette + color->palettesize);
+				preloaded.valid = true;
+			}
+		}
+		std::vector<unsigned char>().swap(preloaded.png);
+	});
+}
+
+/**
+ * Frees all preloaded images that weren't loaded.
+ */
+void Surface::clearPreloadedImages()
+{
+	preloadedImages.clear();
+}
+
 /**
  * Loads the contents of an X-Com SPK image file into
  * the surface. SPK files are compressed with a custom
@@ -81,6 +81,17 @@ public:
 	/// Zero whole surface.
 	static void CleanSdlSurface(SDL_Surface* surface);
 
+	/// Counters of surface buffer allocations.
+	struct BufferCounts
+	{
+		/// Buffers allocated from the heap.
+		int allocated = 0;
+		/// Buffers reused from the pool.
+		int reused = 0;
+	};
+	/// Gets and resets the buffer allocation counters.
+	static BufferCounts takeBufferCounts();
+
 protected:
 	UniqueBufferPtr _alignedBuffer;
 	UniqueSurfacePtr _surface;
@@ -95,6 +106,8 @@ protected:
 	void rawCopy(const std::vector<T> &bytes);
 	/// Resizes the surface.
 	void resize(int width, int height);
+	/// Fills the surface from a decoded 8bpp PNG image.
+	void loadPngPixels(const std::string &filename, std::vector<unsigned char> &image, unsigned width, unsigned height, const SDL_Color *palette, int ncolors);
 public:
 	/// Default empty surface.
 	Surface();
@@ -129,6 +142,10 @@ public:
 	void loadBdy(const std::string &filename);
 	/// Loads a general image file.
 	void loadImage(const std::string &filename);
+	/// Decodes PNG images ahead of time on worker threads.
+	static void preloadImages(const std::vector<std::string> &filenames);
+	/// Frees preloaded images that were never loaded.
+	static void clearPreloadedImages();
 	/// Clears the surface's contents with a specified colour.
 	void clear();
 	/// Offsets the surface's colors by a set amount.
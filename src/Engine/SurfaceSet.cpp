@@ -18,19 +18,72 @@
  */
 #include "SurfaceSet.h"
 #include <climits>
+#include <iterator>
 #include "Surface.h"
 #include "Exception.h"
 #include "FileMap.h"
+#include "Options.h"
 
 namespace OpenXcom
 {
 
+namespace
+{
+
+/// Marks frames without PCK data to decode.
+const size_t NoPckData = (size_t)-1;
+
+/**
+ * Decodes one RLE compressed PCK frame into a surface.
+ * @param frame Surface to draw the frame on.
+ * @param data Start of the frame data.
+ * @param end End of the PCK data.
+ */
+void decodePckFrame(Surface &frame, const Uint8 *data, const Uint8 *end)
+{
+	int x = 0, y = 0;
+	const int width = frame.getWidth();
+
+	// Lock the surface
+	frame.lock();
+
+	Uint8 value = (data < end) ? *data++ : 0;
+	for (int i = 0; i < value; ++i)
+	{
+		for (int j = 0; j < width; ++j)
+		{
+			frame.setPixelIterative(&x, &y, 0);
+		}
+	}
+
+	while (data < end && (value = *data++) != 255)
+	{
+		if (value == 254)
+		{
+			value = (data < end) ? *data++ : 0;
+			for (int i = 0; i < value; ++i)
+			{
+				frame.setPixelIterative(&x, &y, 0);
+			}
+		}
+		else
+		{
+			frame.setPixelIterative(&x, &y, value);
+		}
+	}
+
+	// Unlock the surface
+	frame.unlock();
+}
+
+}
+
 /**
  * Sets up a new empty surface set for frames of the specified size.
  * @param width Frame width in pixels.
  * @param height Frame height in pixels.
  */
-SurfaceSet::SurfaceSet(int width, int height) : _width(width), _height(height), _sharedFrames(INT_MAX)
+SurfaceSet::SurfaceSet(int width, int height) : _width(width), _height(height), _sharedFrames(INT_MAX), _pckPending(0)
 {
 
 }
@@ -44,6 +97,10 @@ SurfaceSet::SurfaceSet(const SurfaceSet& other)
 	_width = other._width;
 	_height = other._height;
 	_sharedFrames = other._sharedFrames;
+	_pckData = other._pckData;
+	_pckOffsets = other._pckOffsets;
+	_pckPending = other._pckPending;
+	_palette = other._palette;
 
 	_frames.resize(other._frames.size());
 	for (size_t i = 0; i < _frames.size(); ++i)
@@ -64,7 +121,8 @@ SurfaceSet::~SurfaceSet()
  * Loads the contents of an X-Com set of PCK/TAB image files
  * into the surface. The PCK file contains an RLE compressed
  * image, while the TAB file contains the offsets to each
- * frame in the image.
+ * frame in the image. With lazy loading, frames are only
+ * decoded when they are first requested.
  * @param pck Filename of the PCK image.
  * @param tab Filename of the TAB offsets.
  * @sa http://www.ufopaedia.org/index.php?title=Image_Formats#PCK
@@ -72,6 +130,10 @@ SurfaceSet::~SurfaceSet()
 void SurfaceSet::loadPck(const std::string &pck, const std::string &tab)
 {
 	_frames.clear();
+	_pckOffsets.clear();
+	_pckPending = 0;
+	_pckData.reset();
+	_palette.clear();
 
 	int nframes = 0;
 
@@ -96,54 +158,74 @@ void SurfaceSet::loadPck(const std::string &pck, const std::string &tab)
 		{
 			nframes = size / 4;
 		}
-		for (int frame = 0; frame < nframes; ++frame)
-		{
-			_frames.push_back(Surface(_width, _height));
-		}
 	}
 	else
 	{
 		nframes = 1;
-		_frames.push_back(Surface(_width, _height));
 	}
 
 	auto imgFile = FileMap::getIStream(pck);
-	Uint8 value;
+	auto data = std::make_shared<std::vector<Uint8> >(std::istreambuf_iterator<char>(*imgFile), std::istreambuf_iterator<char>());
 
+	// Frames follow each other, find where each one starts
+	_pckOffsets.resize(nframes);
+	size_t pos = 0;
 	for (int frame = 0; frame < nframes; ++frame)
 	{
-		int x = 0, y = 0;
-
-		// Lock the surface
-		_frames[frame].lock();
-
-		imgFile->read((char*)&value, 1);
-		for (int i = 0; i < value; ++i)
+		_pckOffsets[frame] = pos;
+		++pos;
+		while (pos < data->size())
 		{
-			for (int j = 0; j < _width; ++j)
+			Uint8 value = (*data)[pos++];
+			if (value == 255)
+			{
+				break;
+			}
+			if (value == 254)
 			{
-				_frames[frame].setPixelIterative(&x, &y, 0);
+				++pos;
 			}
 		}
+	}
+	_pckData = data;
+	_pckPending = nframes;
+	_frames.resize(nframes);
 
-		while (imgFile->read((char*)&value, 1) && value != 255)
+	if (!Options::lazyLoadResources)
+	{
+		for (int frame = 0; frame < nframes; ++frame)
 		{
-			if (value == 254)
-			{
-				imgFile->read((char*)&value, 1);
-				for (int i = 0; i < value; ++i)
-				{
-					_frames[frame].setPixelIterative(&x, &y, 0);
-				}
-			}
-			else
-			{
-				_frames[frame].setPixelIterative(&x, &y, value);
-			}
+			decodeFrame(frame);
 		}
+	}
+}
 
-		// Unlock the surface
-		_frames[frame].unlock();
+/**
+ * Decodes a frame of a PCK image on first use.
+ * The PCK data is released once every frame is decoded.
+ * @param i Frame number in the set.
+ */
+void SurfaceSet::decodeFrame(size_t i)
+{
+	if (i >= _pckOffsets.size() || _pckOffsets[i] == NoPckData)
+	{
+		return;
+	}
+
+	const Uint8 *begin = _pckData->data();
+	const Uint8 *end = begin + _pckData->size();
+	_frames[i] = Surface(_width, _height);
+	if (!_palette.empty())
+	{
+		_frames[i].setPalette(_palette.data());
+	}
+	decodePckFrame(_frames[i], begin + std::min(_pckOffsets[i], _pckData->size()), end);
+	_pckOffsets[i] = NoPckData;
+
+	if (--_pckPending == 0)
+	{
+		_pckOffsets.clear();
+		_pckData.reset();
 	}
 }
 
@@ -158,6 +240,9 @@ void SurfaceSet::loadPck(const std::string &pck, const std::string &tab)
 void SurfaceSet::loadDat(const std::string &filename)
 {
 	int nframes = 0;
+	_pckOffsets.clear();
+	_pckPending = 0;
+	_pckData.reset();
 
 	auto imgFile = FileMap::getIStream(filename);
 	imgFile->seekg(0, std::ios::end);
@@ -208,6 +293,7 @@ Surface *SurfaceSet::getFrame(int i)
 {
 	if ((size_t)i < _frames.size())
 	{
+		decodeFrame(i);
 		if (_frames[i])
 		{
 			return &_frames[i];
@@ -232,6 +318,15 @@ Surface *SurfaceSet::addFrame(int i)
 	{
 		_frames.resize(i + 1);
 	}
+	if ((size_t)i < _pckOffsets.size() && _pckOffsets[i] != NoPckData)
+	{
+		_pckOffsets[i] = NoPckData;
+		if (--_pckPending == 0)
+		{
+			_pckOffsets.clear();
+			_pckData.reset();
+		}
+	}
 	_frames[i] = Surface(_width, _height);
 	return &_frames[i];
 }
@@ -295,6 +390,15 @@ size_t SurfaceSet::getTotalFrames() const
  */
 void SurfaceSet::setPalette(const SDL_Color *colors, int firstcolor, int ncolors)
 {
+	if (_pckData)
+	{
+		if (_palette.empty())
+		{
+			Surface blank(1, 1);
+			_palette.assign(blank.getPalette(), blank.getPalette() + 256);
+		}
+		std::copy(colors, colors + ncolors, _palette.begin() + firstcolor);
+	}
 	for (size_t i = 0; i < _frames.size(); ++i)
 	{
 		if (_frames[i])
@@ -20,6 +20,7 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 #include <SDL.h>
 
 namespace OpenXcom
@@ -39,6 +40,17 @@ private:
 	std::vector<Surface> _frames;
 	int _width, _height;
 	int _sharedFrames;
+	/// Raw PCK data of frames that weren't decoded yet, shared between copies.
+	std::shared_ptr<const std::vector<Uint8> > _pckData;
+	/// Offset of each frame in the PCK data, or npos if it doesn't need decoding.
+	std::vector<size_t> _pckOffsets;
+	/// Number of frames still waiting to be decoded.
+	size_t _pckPending;
+	/// Palette to give frames decoded later, empty if never changed.
+	std::vector<SDL_Color> _palette;
+
+	/// Decodes a frame from the PCK data if it wasn't yet.
+	void decodeFrame(size_t i);
 
 public:
 	/// Crates a surface set with frames of the specified size.
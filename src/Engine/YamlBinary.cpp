@@ -0,0 +1,248 @@
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "YamlBinary.h"
+#include "Exception.h"
+
+namespace OpenXcom
+{
+
+namespace YamlBinary
+{
+
+namespace
+{
+
+/// Node types in the encoding.
+enum BinaryNodeType : Uint8 { BINARY_NULL, BINARY_SCALAR, BINARY_SEQUENCE, BINARY_MAP };
+
+}
+
+/**
+ * Checks there are enough bytes left to read.
+ * @param size Number of bytes needed.
+ * @throw Exception if the data is too short.
+ */
+void Reader::need(size_t size) const
+{
+	if ((size_t)(end - pos) < size)
+	{
+		throw Exception("Binary data is truncated");
+	}
+}
+
+/**
+ * Reads a single byte.
+ * @return Byte value.
+ */
+Uint8 Reader::byte()
+{
+	need(1);
+	return (Uint8)*pos++;
+}
+
+/**
+ * Reads a varint, 7 bits per byte, lowest bits first.
+ * @return Number value.
+ */
+Uint64 Reader::number()
+{
+	Uint64 value = 0;
+	for (int shift = 0; shift < 64; shift += 7)
+	{
+		Uint8 b = byte();
+		value |= (Uint64)(b & 0x7F) << shift;
+		if (!(b & 0x80))
+		{
+			return value;
+		}
+	}
+	throw Exception("Binary data is corrupted");
+}
+
+/**
+ * Reads a little-endian 64-bit number.
+ * @return Number value.
+ */
+Uint64 Reader::fixed64()
+{
+	Uint64 value = 0;
+	for (int i = 0; i < 8; ++i)
+	{
+		value |= (Uint64)byte() << (i * 8);
+	}
+	return value;
+}
+
+/**
+ * Reads a string prefixed by its size.
+ * @return String value.
+ */
+std::string Reader::string()
+{
+	Uint64 size = number();
+	need(size);
+	std::string s(pos, size);
+	pos += size;
+	return s;
+}
+
+/**
+ * Reads a node and all its children.
+ * @return YAML node.
+ */
+YAML::Node Reader::node()
+{
+	switch (byte())
+	{
+	case BINARY_NULL:
+		return YAML::Node(YAML::NodeType::Null);
+	case BINARY_SCALAR:
+		return YAML::Node(string());
+	case BINARY_SEQUENCE:
+	{
+		YAML::Node node(YAML::NodeType::Sequence);
+		for (Uint64 i = number(); i > 0; --i)
+		{
+			node.push_back(this->node());
+		}
+		return node;
+	}
+	case BINARY_MAP:
+	{
+		YAML::Node node(YAML::NodeType::Map);
+		for (Uint64 i = number(); i > 0; --i)
+		{
+			YAML::Node key = this->node();
+			// keys come from a map, so they are unique already
+			node.force_insert(key, this->node());
+		}
+		return node;
+	}
+	default:
+		throw Exception("Binary data is corrupted");
+	}
+}
+
+/**
+ * Writes a varint, 7 bits per byte, lowest bits first.
+ * @param out Output buffer.
+ * @param value Number value.
+ */
+void writeNumber(std::string &out, Uint64 value)
+{
+	while (value >= 0x80)
+	{
+		out += (char)((value & 0x7F) | 0x80);
+		value >>= 7;
+	}
+	out += (char)value;
+}
+
+/**
+ * Writes a little-endian 64-bit number.
+ * @param out Output buffer.
+ * @param value Number value.
+ */
+void writeFixed64(std::string &out, Uint64 value)
+{
+	for (int i = 0; i < 8; ++i)
+	{
+		out += (char)((value >> (i * 8)) & 0xFF);
+	}
+}
+
+/**
+ * Writes a string prefixed by its size.
+ * @param out Output buffer.
+ * @param s String value.
+ */
+void writeString(std::string &out, const std::string &s)
+{
+	writeNumber(out, s.size());
+	out += s;
+}
+
+/**
+ * Writes a node and all its children.
+ * @param out Output buffer.
+ * @param node YAML node.
+ */
+void writeNode(std::string &out, const YAML::Node &node)
+{
+	switch (node.Type())
+	{
+	case YAML::NodeType::Scalar:
+		out += (char)BINARY_SCALAR;
+		writeString(out, node.Scalar());
+		break;
+	case YAML::NodeType::Sequence:
+		out += (char)BINARY_SEQUENCE;
+		writeNumber(out, node.size());
+		for (YAML::const_iterator i = node.begin(); i != node.end(); ++i)
+		{
+			writeNode(out, *i);
+		}
+		break;
+	case YAML::NodeType::Map:
+		out += (char)BINARY_MAP;
+		writeNumber(out, node.size());
+		for (YAML::const_iterator i = node.begin(); i != node.end(); ++i)
+		{
+			writeNode(out, i->first);
+			writeNode(out, i->second);
+		}
+		break;
+	default:
+		out += (char)BINARY_NULL;
+		break;
+	}
+}
+
+/**
+ * Encodes a YAML document into the binary format.
+ * @param doc YAML document.
+ * @return Encoded document.
+ */
+std::string encode(const YAML::Node &doc)
+{
+	std::string out;
+	writeNode(out, doc);
+	return out;
+}
+
+/**
+ * Rebuilds a YAML document from the binary format.
+ * @param data Encoded document.
+ * @return YAML document.
+ * @throw Exception if the data is corrupted.
+ */
+YAML::Node decode(const std::string &data)
+{
+	Reader in = { data.data(), data.data() + data.size() };
+	YAML::Node doc = in.node();
+	if (in.pos != in.end)
+	{
+		throw Exception("Binary data is corrupted");
+	}
+	return doc;
+}
+
+}
+
+}
@@ -0,0 +1,71 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string>
+#include <SDL_types.h>
+#include <yaml-cpp/yaml.h>
+
+namespace OpenXcom
+{
+
+/**
+ * Compact binary encoding of YAML documents.
+ * Only the structure and scalars are kept, tags, styles and
+ * marks are dropped. Numbers are stored as little-endian
+ * base-128 varints, strings are prefixed by their size.
+ */
+namespace YamlBinary
+{
+	/**
+	 * Reads encoded data, checking it doesn't run past the end.
+	 */
+	struct Reader
+	{
+		const char *pos, *end;
+
+		/// Checks there are enough bytes left.
+		void need(size_t size) const;
+		/// Reads a single byte.
+		Uint8 byte();
+		/// Reads a varint.
+		Uint64 number();
+		/// Reads a fixed-size 64-bit number.
+		Uint64 fixed64();
+		/// Reads a size-prefixed string.
+		std::string string();
+		/// Reads a whole node.
+		YAML::Node node();
+	};
+
+	/// Writes a varint.
+	void writeNumber(std::string &out, Uint64 value);
+	/// Writes a fixed-size 64-bit number.
+	void writeFixed64(std::string &out, Uint64 value);
+	/// Writes a size-prefixed string.
+	void writeString(std::string &out, const std::string &s);
+	/// Writes a whole node.
+	void writeNode(std::string &out, const YAML::Node &node);
+
+	/// Encodes a YAML document.
+	std::string encode(const YAML::Node &doc);
+	/// Decodes a YAML document.
+	YAML::Node decode(const std::string &data);
+}
+
+}
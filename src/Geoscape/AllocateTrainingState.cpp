@@ -38,7 +38,6 @@
 #include "../Mod/Mod.h"
 #include "../Basescape/SoldierSortUtil.h"
 #include <algorithm>
-#include "../Engine/Unicode.h"
 
 namespace OpenXcom
 {
@@ -196,16 +195,11 @@ void AllocateTrainingState::cbxSortByChange(Action *action)
 	{
 		if (selIdx == 2)
 		{
-			std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(),
-				[](const Soldier* a, const Soldier* b)
-				{
-					return Unicode::naturalCompare(a->getName(), b->getName());
-				}
-			);
+			sortSoldiersByName(*_base->getSoldiers());
 		}
 		else
 		{
-			std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(), *compFunc);
+			sortSoldiers(_game, *_base->getSoldiers(), compFunc->getGetter());
 		}
 		bool shiftPressed = SDL_GetModState() & KMOD_SHIFT;
 		if (shiftPressed)
@@ -268,7 +268,7 @@ void ConfirmDestinationState::btnOkClick(Action *)
 		// cancel auto-patrol
 		_craft->setIsAutoPatrolling(false);
 	}
-	_craft->setStatus("STR_OUT");
+	_craft->setStatus(CRAFT_OUT);
 	_game->popState();
 	_game->popState();
 }
@@ -45,6 +45,7 @@
 #include "../Savegame/Craft.h"
 #include "../Mod/RuleCraft.h"
 #include "../Savegame/Ufo.h"
+#include "../Savegame/UfoDetector.h"
 #include "../Mod/RuleUfo.h"
 #include "../Mod/RuleArcScript.h"
 #include "../Mod/RuleEventScript.h"
@@ -823,7 +824,7 @@ const std::vector<Craft*>* GeoscapeState::updateActiveCrafts()
 	{
 		for (auto craft : *base->getCrafts())
 		{
-			if (craft->getStatus() == "STR_OUT" && !craft->isDestroyed())
+			if (craft->getStatus() == CRAFT_OUT && !craft->isDestroyed())
 			{
 				_activeCrafts.push_back(craft);
 			}
@@ -1029,21 +1030,13 @@ void GeoscapeState::time5Seconds()
 		{
 			if ((*j)->isDestroyed())
 			{
-				for (std::vector<Country*>::iterator country = _game->getSavedGame()->getCountries()->begin(); country != _game->getSavedGame()->getCountries()->end(); ++country)
+				if (Country *country = _game->getSavedGame()->locateCountry(**j))
 				{
-					if ((*country)->getRules()->insideCountry((*j)->getLongitude(), (*j)->getLatitude()))
-					{
-						(*country)->addActivityXcom(-(*j)->getRules()->getScore());
-						break;
-					}
+					country->addActivityXcom(-(*j)->getRules()->getScore());
 				}
-				for (std::vector<Region*>::iterator region = _game->getSavedGame()->getRegions()->begin(); region != _game->getSavedGame()->getRegions()->end(); ++region)
+				if (Region *region = _game->getSavedGame()->locateRegion(**j))
 				{
-					if ((*region)->getRules()->insideRegion((*j)->getLongitude(), (*j)->getLatitude()))
-					{
-						(*region)->addActivityXcom(-(*j)->getRules()->getScore());
-						break;
-					}
+					region->addActivityXcom(-(*j)->getRules()->getScore());
 				}
 				// if a transport craft has been shot down, kill all the soldiers on board.
 				if ((*j)->getRules()->getSoldiers() > 0)
@@ -1302,7 +1295,7 @@ void GeoscapeState::time5Seconds()
 				}
 				else if (x != 0)
 				{
-					if (x->getStatus() != "STR_OUT" || x->isDestroyed())
+					if (x->getStatus() != CRAFT_OUT || x->isDestroyed())
 					{
 						(*j)->returnToBase();
 					}
@@ -1416,7 +1409,7 @@ void GeoscapeState::time10Minutes()
 		// Fuel consumption for XCOM craft.
 		for (std::vector<Craft*>::iterator j = (*i)->getCrafts()->begin(); j != (*i)->getCrafts()->end(); ++j)
 		{
-			if ((*j)->getStatus() == "STR_OUT")
+			if ((*j)->getStatus() == CRAFT_OUT)
 			{
 				int escortSpeed = 0;
 				{
@@ -1604,7 +1597,7 @@ void GeoscapeState::baseHunting()
 				for (auto craft : *crafts)
 				{
 					// Craft is flying (i.e. not in base)
-					if (craft->getStatus() == "STR_OUT" && !craft->isDestroyed())
+					if (craft->getStatus() == CRAFT_OUT && !craft->isDestroyed())
 					{
 						// Craft is close enough and RNG is in our favour
 						if (craft->getDistance((*ab)) < Nautical((*ab)->getDeployment()->getBaseDetectionRange()) && RNG::percent((*ab)->getDeployment()->getBaseDetectionChance()))
@@ -1747,22 +1740,53 @@ void GeoscapeState::time30Minutes()
 	// Handle craft maintenance and alien base detection
 	for (auto base : *_game->getSavedGame()->getBases())
 	{
-		for (auto craft : *base->getCrafts())
+		// copy, refuelling changes the craft status
+		std::vector<Craft*> refuelling = base->getCraftsByStatus(CRAFT_REFUELLING);
+		for (auto craft : refuelling)
 		{
-			if (craft->getStatus() == "STR_REFUELLING")
+			std::string item = craft->getRules()->getRefuelItem();
+			if (item.empty())
 			{
-				std::string item = craft->getRules()->getRefuelItem();
-				if (item.empty())
+				craft->refuel();
+				// notification
+				if (craft->getStatus() == CRAFT_READY && craft->getRules()->notifyWhenRefueled())
+				{
+					std::string msg = tr("STR_CRAFT_IS_READY").arg(craft->getName(_game->getLanguage())).arg(base->getName());
+					popup(new CraftErrorState(this, msg));
+				}
+				// auto-patrol
+				if (craft->getStatus() == CRAFT_READY && craft->getRules()->canAutoPatrol())
 				{
+					if (craft->getIsAutoPatrolling())
+					{
+						Waypoint *w = new Waypoint();
+						w->setLongitude(craft->getLongitudeAuto());
+						w->setLatitude(craft->getLatitudeAuto());
+						if (w != 0 && w->getId() == 0)
+						{
+							w->setId(_game->getSavedGame()->getId("STR_WAY_POINT"));
+							_game->getSavedGame()->getWaypoints()->push_back(w);
+						}
+						craft->setDestination(w);
+						craft->setStatus(CRAFT_OUT);
+					}
+				}
+			}
+			else
+			{
+				if (base->getStorageItems()->getItem(item) > 0)
+				{
+					base->getStorageItems()->removeItem(item);
 					craft->refuel();
+					craft->setLowFuel(false);
 					// notification
-					if (craft->getStatus() == "STR_READY" && craft->getRules()->notifyWhenRefueled())
+					if (craft->getStatus() == CRAFT_READY && craft->getRules()->notifyWhenRefueled())
 					{
 						std::string msg = tr("STR_CRAFT_IS_READY").arg(craft->getName(_game->getLanguage())).arg(base->getName());
 						popup(new CraftErrorState(this, msg));
 					}
 					// auto-patrol
-					if (craft->getStatus() == "STR_READY" && craft->getRules()->canAutoPatrol())
+					if (craft->getStatus() == CRAFT_READY && craft->getRules()->canAutoPatrol())
 					{
 						if (craft->getIsAutoPatrolling())
 						{
@@ -1775,56 +1799,24 @@ void GeoscapeState::time30Minutes()
 								_game->getSavedGame()->getWaypoints()->push_back(w);
 							}
 							craft->setDestination(w);
-							craft->setStatus("STR_OUT");
+							craft->setStatus(CRAFT_OUT);
 						}
 					}
 				}
-				else
+				else if (!craft->getLowFuel())
 				{
-					if (base->getStorageItems()->getItem(item) > 0)
+					std::string msg = tr("STR_NOT_ENOUGH_ITEM_TO_REFUEL_CRAFT_AT_BASE")
+									   .arg(tr(item))
+									   .arg(craft->getName(_game->getLanguage()))
+									   .arg(base->getName());
+					popup(new CraftErrorState(this, msg));
+					if (craft->getFuel() > 0)
 					{
-						base->getStorageItems()->removeItem(item);
-						craft->refuel();
-						craft->setLowFuel(false);
-						// notification
-						if (craft->getStatus() == "STR_READY" && craft->getRules()->notifyWhenRefueled())
-						{
-							std::string msg = tr("STR_CRAFT_IS_READY").arg(craft->getName(_game->getLanguage())).arg(base->getName());
-							popup(new CraftErrorState(this, msg));
-						}
-						// auto-patrol
-						if (craft->getStatus() == "STR_READY" && craft->getRules()->canAutoPatrol())
-						{
-							if (craft->getIsAutoPatrolling())
-							{
-								Waypoint *w = new Waypoint();
-								w->setLongitude(craft->getLongitudeAuto());
-								w->setLatitude(craft->getLatitudeAuto());
-								if (w != 0 && w->getId() == 0)
-								{
-									w->setId(_game->getSavedGame()->getId("STR_WAY_POINT"));
-									_game->getSavedGame()->getWaypoints()->push_back(w);
-								}
-								craft->setDestination(w);
-								craft->setStatus("STR_OUT");
-							}
-						}
+						craft->setStatus(CRAFT_READY);
 					}
-					else if (!craft->getLowFuel())
+					else
 					{
-						std::string msg = tr("STR_NOT_ENOUGH_ITEM_TO_REFUEL_CRAFT_AT_BASE")
-										   .arg(tr(item))
-										   .arg(craft->getName(_game->getLanguage()))
-										   .arg(base->getName());
-						popup(new CraftErrorState(this, msg));
-						if (craft->getFuel() > 0)
-						{
-							craft->setStatus("STR_READY");
-						}
-						else
-						{
-							craft->setLowFuel(true);
-						}
+						craft->setLowFuel(true);
 					}
 				}
 			}
@@ -1835,6 +1827,7 @@ void GeoscapeState::time30Minutes()
 	auto crafts = updateActiveCrafts();
 
 	// Handle UFO detection and give aliens points
+	UfoDetector detector(*_game->getSavedGame()->getBases(), *crafts);
 	for (auto ufo : *_game->getSavedGame()->getUfos())
 	{
 		int points = ufo->getRules()->getMissionScore(); //one point per UFO in-flight per half hour
@@ -1845,22 +1838,14 @@ void GeoscapeState::time30Minutes()
 			FALLTHROUGH;
 		case Ufo::FLYING:
 			// Get area
-			for (auto region : *_game->getSavedGame()->getRegions())
+			if (Region *region = _game->getSavedGame()->locateRegion(*ufo))
 			{
-				if (region->getRules()->insideRegion(ufo->getLongitude(), ufo->getLatitude()))
-				{
-					region->addActivityAlien(points);
-					break;
-				}
+				region->addActivityAlien(points);
 			}
 			// Get country
-			for (auto country : *_game->getSavedGame()->getCountries())
+			if (Country *country = _game->getSavedGame()->locateCountry(*ufo))
 			{
-				if (country->getRules()->insideCountry(ufo->getLongitude(), ufo->getLatitude()))
-				{
-					country->addActivityAlien(points);
-					break;
-				}
+				country->addActivityAlien(points);
 			}
 
 			// Detection ufo state
@@ -1869,23 +1854,9 @@ void GeoscapeState::time30Minutes()
 				{
 					return (value & mask) == mask;
 				};
-				auto maskBitOr = [](UfoDetection value, UfoDetection mask)
-				{
-					return (UfoDetection)(value | mask);
-				};
 
-				auto detected = DETECTION_NONE;
 				auto alreadyTracked = ufo->getDetected();
-
-				for (auto base : *_game->getSavedGame()->getBases())
-				{
-					detected = maskBitOr(detected, base->detect(ufo, alreadyTracked));
-				}
-
-				for (auto craft : *crafts)
-				{
-					detected = maskBitOr(detected, craft->detect(ufo, alreadyTracked));
-				}
+				auto detected = detector.detect(ufo, alreadyTracked);
 
 				if (!alreadyTracked)
 				{
@@ -1980,25 +1951,28 @@ void GeoscapeState::time1Hour()
 	// Handle craft maintenance
 	for (std::vector<Base*>::iterator i = _game->getSavedGame()->getBases()->begin(); i != _game->getSavedGame()->getBases()->end(); ++i)
 	{
-		for (std::vector<Craft*>::iterator j = (*i)->getCrafts()->begin(); j != (*i)->getCrafts()->end(); ++j)
+		// copies, repairing and rearming change the craft status
+		std::vector<Craft*> repairing = (*i)->getCraftsByStatus(CRAFT_REPAIRS);
+		std::vector<Craft*> rearming = (*i)->getCraftsByStatus(CRAFT_REARMING);
+		for (std::vector<Craft*>::iterator j = repairing.begin(); j != repairing.end(); ++j)
 		{
-			if ((*j)->getStatus() == "STR_REPAIRS")
-			{
-				(*j)->repair();
-			}
-			else if ((*j)->getStatus() == "STR_REARMING")
+			(*j)->repair();
+		}
+		for (std::vector<Craft*>::iterator j = rearming.begin(); j != rearming.end(); ++j)
+		{
+			std::string s = (*j)->rearm(_game->getMod());
+			if (!s.empty())
 			{
-				std::string s = (*j)->rearm(_game->getMod());
-				if (!s.empty())
-				{
-					std::string msg = tr("STR_NOT_ENOUGH_ITEM_TO_REARM_CRAFT_AT_BASE")
-									   .arg(tr(s))
-									   .arg((*j)->getName(_game->getLanguage()))
-									   .arg((*i)->getName());
-					popup(new CraftErrorState(this, msg));
-				}
+				std::string msg = tr("STR_NOT_ENOUGH_ITEM_TO_REARM_CRAFT_AT_BASE")
+								   .arg(tr(s))
+								   .arg((*j)->getName(_game->getLanguage()))
+								   .arg((*i)->getName());
+				popup(new CraftErrorState(this, msg));
 			}
-			if ((*j)->getShieldCapacity() > 0 && (*j)->getStatus() != "STR_OUT")
+		}
+		for (std::vector<Craft*>::iterator j = (*i)->getCrafts()->begin(); j != (*i)->getCrafts()->end(); ++j)
+		{
+			if ((*j)->getShieldCapacity() > 0 && (*j)->getStatus() != CRAFT_OUT)
 			{
 				// Recharge craft shields in parallel (no wait for repair/rearm/refuel)
 				(*j)->setShield((*j)->getShield() + (*j)->getRules()->getShieldRechargeAtBase());
@@ -287,20 +287,36 @@ struct CreateShadow
 		return Globe::OCEAN_SHADING && dest >= Globe::OCEAN_COLOR && dest < Globe::OCEAN_COLOR + 32;
 	}
 
-	static inline void func(Uint8& dest, const Cord& earth, const Cord& sun, const Sint16& noise)
+	static inline void func(Uint8& shadow, const Cord& earth, const Cord& sun, const Sint16& noise)
 	{
-		if (dest && earth.z)
+		shadow = earth.z ? getShadowValue(earth, sun, noise) : OffGlobe;
+	}
+
+	/// Shadow cache value for pixels outside the globe.
+	static const Uint8 OffGlobe = 0xFF;
+	/// Shadow cache value for pixels the earth normals don't cover.
+	static const Uint8 Uncovered = 0xFE;
+};
+
+struct ApplyShadow
+{
+	static inline void func(Uint8& dest, const Uint8& shadow)
+	{
+		if (shadow == CreateShadow::Uncovered)
+		{
+			return;
+		}
+		if (dest && shadow != CreateShadow::OffGlobe)
 		{
-			const Uint8 shadow = getShadowValue(earth, sun, noise);
 			//this pixel is ocean
-			if (isOcean(dest))
+			if (CreateShadow::isOcean(dest))
 			{
-				dest = getOceanShadow(shadow);
+				dest = CreateShadow::getOceanShadow(shadow);
 			}
 			//this pixel is land
 			else
 			{
-				dest = getLandShadow(dest, shadow);
+				dest = CreateShadow::getLandShadow(dest, shadow);
 			}
 		}
 		else
@@ -324,7 +340,8 @@ struct CreateShadow
  * @param y Y position in pixels.
  */
 Globe::Globe(Game* game, int cenX, int cenY, int width, int height, int x, int y) : InteractiveSurface(width, height, x, y), _cenX(cenX), _cenY(cenY), _rotLon(0.0), _rotLat(0.0), _hoverLon(0.0), _hoverLat(0.0), _craftLon(0.0), _craftLat(0.0), _craftRange(0.0), _game(game), _hover(false), _craft(false), _blink(-1),
-																					_isMouseScrolling(false), _isMouseScrolled(false), _xBeforeMouseScrolling(0), _yBeforeMouseScrolling(0), _lonBeforeMouseScrolling(0.0), _latBeforeMouseScrolling(0.0), _mouseScrollingStartTime(0), _totalMouseMoveX(0), _totalMouseMoveY(0), _mouseMovedOverThreshold(false)
+																					_isMouseScrolling(false), _isMouseScrolled(false), _xBeforeMouseScrolling(0), _yBeforeMouseScrolling(0), _lonBeforeMouseScrolling(0.0), _latBeforeMouseScrolling(0.0), _mouseScrollingStartTime(0), _totalMouseMoveX(0), _totalMouseMoveY(0), _mouseMovedOverThreshold(false),
+																					_shadowZoom(0), _shadowCenX(0), _shadowCenY(0)
 {
 	_rules = game->getMod()->getGlobe();
 	_texture = new SurfaceSet(*_game->getMod()->getSurfaceSet("TEXTURE.DAT"));
@@ -365,11 +382,6 @@ Globe::~Globe()
 	delete _texture;
 	delete _radars;
 	delete _clipper;
-
-	for (std::list<Polygon*>::iterator i = _cacheLand.begin(); i != _cacheLand.end(); ++i)
-	{
-		delete *i;
-	}
 }
 
 /**
@@ -463,7 +475,8 @@ Polygon* Globe::getPolygonFromLonLat(double lon, double lat) const
 	double coslat = cos(lat);
 	double sinlat = sin(lat);
 
-	for (std::list<Polygon*>::iterator i = _rules->getPolygons()->begin(); i != _rules->getPolygons()->end(); ++i)
+	const std::vector<Polygon*> &polygons = _rules->getPolygonsNear(lon, lat);
+	for (std::vector<Polygon*>::const_iterator i = polygons.begin(); i != polygons.end(); ++i)
 	{
 		double x, y, z, x2, y2;
 		double clat, clon;
@@ -829,33 +842,31 @@ std::vector<Target*> Globe::getTargets(int x, int y, bool craft, Craft *currentC
  */
 void Globe::cachePolygons()
 {
-	cache(_rules->getPolygons(), &_cacheLand);
-}
+	const GlobeVertices &v = _rules->getVertices();
+	_cacheLand.clear();
+	_cacheX.clear();
+	_cacheY.clear();
 
-/**
- * Caches a set of polygons.
- * @param polygons Pointer to list of polygons.
- * @param cache Pointer to cache.
- */
-void Globe::cache(std::list<Polygon*> *polygons, std::list<Polygon*> *cache)
-{
-	// Clear existing cache
-	for (std::list<Polygon*>::iterator i = cache->begin(); i != cache->end(); ++i)
-	{
-		delete *i;
-	}
-	cache->clear();
+	// Rotate the globe so the view looks down the Z axis
+	const double sinLon = sin(_cenLon), cosLon = cos(_cenLon);
+	const double sinLat = sin(_cenLat), cosLat = cos(_cenLat);
+	const double xx = -sinLon, xy = cosLon;
+	const double yx = -sinLat * cosLon, yy = -sinLat * sinLon, yz = cosLat;
+	const double zx = cosLat * cosLon, zy = cosLat * sinLon, zz = sinLat;
 
-	// Pre-calculate values to cache
-	for (std::list<Polygon*>::iterator i = polygons->begin(); i != polygons->end(); ++i)
+	for (size_t i = 0; i < v.polygons.size(); ++i)
 	{
+		// Is the whole polygon behind the globe?
+		if (zx * v.capX[i] + zy * v.capY[i] + zz * v.capZ[i] < v.capLimit[i])
+			continue;
+
 		// Is quad on the back face?
 		double closest = 0.0;
 		double z;
 		double furthest = 0.0;
-		for (int j = 0; j < (*i)->getPoints(); ++j)
+		for (size_t j = v.first[i]; j < v.first[i + 1]; ++j)
 		{
-			z = cos(_cenLat) * cos((*i)->getLatitude(j)) * cos((*i)->getLongitude(j) - _cenLon) + sin(_cenLat) * sin((*i)->getLatitude(j));
+			z = zx * v.x[j] + zy * v.y[j] + zz * v.z[j];
 			if (z > closest)
 				closest = z;
 			else if (z < furthest)
@@ -864,18 +875,13 @@ void Globe::cache(std::list<Polygon*> *polygons, std::list<Polygon*> *cache)
 		if (-furthest > closest)
 			continue;
 
-		Polygon* p = new Polygon(**i);
-
 		// Convert coordinates
-		for (int j = 0; j < p->getPoints(); ++j)
+		for (size_t j = v.first[i]; j < v.first[i + 1]; ++j)
 		{
-			Sint16 x, y;
-			polarToCart(p->getLongitude(j), p->getLatitude(j), &x, &y);
-			p->setX(j, x);
-			p->setY(j, y);
+			_cacheX.push_back(_cenX + (Sint16)floor(_radius * (xx * v.x[j] + xy * v.y[j])));
+			_cacheY.push_back(_cenY + (Sint16)floor(_radius * (yx * v.x[j] + yy * v.y[j] + yz * v.z[j])));
 		}
-
-		cache->push_back(p);
+		_cacheLand.push_back(v.polygons[i]);
 	}
 }
 
@@ -969,19 +975,12 @@ void Globe::drawOcean()
  */
 void Globe::drawLand()
 {
-	Sint16 x[4], y[4];
-
-	for (std::list<Polygon*>::iterator i = _cacheLand.begin(); i != _cacheLand.end(); ++i)
+	size_t first = 0;
+	for (std::vector<Polygon*>::iterator i = _cacheLand.begin(); i != _cacheLand.end(); ++i)
 	{
-		// Convert coordinates
-		for (int j = 0; j < (*i)->getPoints(); ++j)
-		{
-			x[j] = (*i)->getX(j);
-			y[j] = (*i)->getY(j);
-		}
-
 		// Apply textures according to zoom and shade
-		drawTexturedPolygon(x, y, (*i)->getPoints(), _texture->getFrame((*i)->getTexture() + _zoomTexture), 0, 0);
+		drawTexturedPolygon(&_cacheX[first], &_cacheY[first], (*i)->getPoints(), _texture->getFrame((*i)->getTexture() + _zoomTexture), 0, 0);
+		first += (*i)->getPoints();
 	}
 }
 
@@ -1043,13 +1042,33 @@ Cord Globe::getSunDirection(double lon, double lat) const
 
 void Globe::drawShadow()
 {
-	auto earth = ShaderMove<Cord>(SurfaceRaw<Cord>(_earthData[_zoom], getWidth(), getHeight()));
-	auto noise = ShaderRepeat<Sint16>(SurfaceRaw<Sint16>(static_data.random_noise, static_data.random_surf_size, static_data.random_surf_size));
+	// a sun this close to the cached one moves the shading by less than one gradient step
+	const double sunEpsilon = 1.0 / 500.0;
 
-	earth.setMove(_cenX-getWidth()/2, _cenY-getHeight()/2);
+	const int width = getWidth(), height = getHeight();
+	Cord sun = getSunDirection(_cenLon, _cenLat);
+	Cord sunDiff = sun;
+	sunDiff -= _shadowSun;
+	if (_shadowCache.size() != (size_t)(width * height) || _shadowZoom != _zoom || _shadowCenX != _cenX || _shadowCenY != _cenY ||
+		sunDiff.x * sunDiff.x + sunDiff.y * sunDiff.y + sunDiff.z * sunDiff.z >= sunEpsilon * sunEpsilon)
+	{
+		auto earth = ShaderMove<Cord>(SurfaceRaw<Cord>(_earthData[_zoom], width, height));
+		auto noise = ShaderRepeat<Sint16>(SurfaceRaw<Sint16>(static_data.random_noise, static_data.random_surf_size, static_data.random_surf_size));
+
+		earth.setMove(_cenX-width/2, _cenY-height/2);
+
+		_shadowCache.assign(width * height, CreateShadow::Uncovered);
+		ShaderDraw<CreateShadow>(ShaderSurface(SurfaceRaw<Uint8>(_shadowCache, width, height)), earth, ShaderScalar(sun), noise);
+		_shadowSun.x = sun.x;
+		_shadowSun.y = sun.y;
+		_shadowSun.z = sun.z;
+		_shadowZoom = _zoom;
+		_shadowCenX = _cenX;
+		_shadowCenY = _cenY;
+	}
 
 	lock();
-	ShaderDraw<CreateShadow>(ShaderSurface(this), earth, ShaderScalar(getSunDirection(_cenLon, _cenLat)), noise);
+	ShaderDraw<ApplyShadow>(ShaderSurface(this), ShaderSurface(SurfaceRaw<Uint8>(_shadowCache, width, height)));
 	unlock();
 
 }
@@ -1192,7 +1211,7 @@ void Globe::drawRadars()
 		// Draw radars around player craft
 		for (std::vector<Craft*>::iterator j = (*i)->getCrafts()->begin(); j != (*i)->getCrafts()->end(); ++j)
 		{
-			if ((*j)->getStatus() != "STR_OUT")
+			if ((*j)->getStatus() != CRAFT_OUT)
 				continue;
 			lat=(*j)->getLatitude();
 			lon=(*j)->getLongitude();
@@ -1605,7 +1624,7 @@ void Globe::drawFlights()
 		for (std::vector<Craft*>::iterator j = (*i)->getCrafts()->begin(); j != (*i)->getCrafts()->end(); ++j)
 		{
 			// Hide crafts docked at base
-			if ((*j)->getStatus() != "STR_OUT" || (*j)->getDestination() == 0 /*|| pointBack((*j)->getLongitude(), (*j)->getLatitude())*/)
+			if ((*j)->getStatus() != CRAFT_OUT || (*j)->getDestination() == 0 /*|| pointBack((*j)->getLongitude(), (*j)->getLatitude())*/)
 				continue;
 
 			double lon1 = (*j)->getLongitude();
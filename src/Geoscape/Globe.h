@@ -64,7 +64,8 @@ private:
 	bool _hover, _craft;
 	int _blink;
 	Timer *_blinkTimer, *_rotTimer;
-	std::list<Polygon*> _cacheLand;
+	std::vector<Polygon*> _cacheLand;
+	std::vector<Sint16> _cacheX, _cacheY;
 	FastLineClip *_clipper;
 	double _radius, _radiusStep;
 	///normal of each pixel in earth globe per zoom level
@@ -78,6 +79,11 @@ private:
 	Uint32 _mouseScrollingStartTime;
 	int _totalMouseMoveX, _totalMouseMoveY;
 	bool _mouseMovedOverThreshold;
+	///shade of each pixel for the last sun direction and view
+	std::vector<Uint8> _shadowCache;
+	Cord _shadowSun;
+	size_t _shadowZoom;
+	Sint16 _shadowCenX, _shadowCenY;
 
 	/// Sets the globe zoom factor.
 	void setZoom(size_t zoom);
@@ -89,8 +95,6 @@ private:
 	Polygon* getPolygonFromLonLat(double lon, double lat) const;
 	/// Checks if a target is near a point.
 	bool targetNear(Target* target, int x, int y) const;
-	/// Caches a set of polygons.
-	void cache(std::list<Polygon*> *polygons, std::list<Polygon*> *cache);
 	/// Get position of sun relative to given position in polar cords and date.
 	Cord getSunDirection(double lon, double lat) const;
 	/// Draw globe range circle.
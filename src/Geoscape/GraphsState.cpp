@@ -53,7 +53,8 @@ struct GraphButInfo
  * Initializes all the elements in the Graphs screen.
  * @param game Pointer to the core game.
  */
-GraphsState::GraphsState() : _butRegionsOffset(0), _butCountriesOffset(0), _zoom(100)
+GraphsState::GraphsState() : _butRegionsOffset(0), _butCountriesOffset(0), _zoom(100),
+	_alienRegionScale(0, 0), _xcomRegionScale(0, 0), _alienCountryScale(0, 0), _xcomCountryScale(0, 0), _incomeScale(0, 0), _financeScale(0, 0)
 {
 	// Create object
 	_bg = new InteractiveSurface(320, 200, 0, 0);
@@ -783,105 +784,70 @@ void GraphsState::drawCountryLines()
 	range = upperLimit - lowerLimit;
 	double units = range / 126;
 
-	// draw country line
+	// draw country lines, unless they're already drawn at this scale
+	std::vector<Surface *> &lines = _alien ? _alienCountryLines : (_income ? _incomeLines : _xcomCountryLines);
+	std::pair<int, int> &drawnScale = _alien ? _alienCountryScale : (_income ? _incomeScale : _xcomCountryScale);
+	bool redraw = (drawnScale != std::make_pair(lowerLimit, upperLimit));
+	drawnScale = std::make_pair(lowerLimit, upperLimit);
 	for (size_t entry = 0; entry != _game->getSavedGame()->getCountries()->size(); ++entry)
 	{
-		Country *country = _game->getSavedGame()->getCountries()->at(entry);
-		_alienCountryLines.at(entry)->clear();
-		_xcomCountryLines.at(entry)->clear();
-		_incomeLines.at(entry)->clear();
-		std::vector<Sint16> newLineVector;
-		int reduction = 0;
-		for (size_t iter = 0; iter != 12; ++iter)
+		if (redraw)
 		{
-			int x = 312 - (iter*17);
-			int y = 175 - (-lowerLimit / units);
-			if (_alien)
-			{
-				if (iter < country->getActivityAlien().size())
-				{
-					reduction = country->getActivityAlien().at(country->getActivityAlien().size()-(1+iter)) / units;
-					y -= reduction;
-					totals[iter] += country->getActivityAlien().at(country->getActivityAlien().size()-(1+iter));
-				}
-			}
-			else if (_income)
-			{
-				if (iter < country->getFunding().size())
-				{
-					reduction = (country->getFunding().at(country->getFunding().size()-(1+iter)) / 1000) / units;
-					y -= reduction;
-					totals[iter] += country->getFunding().at(country->getFunding().size()-(1+iter)) / 1000;
-				}
-			}
-			else
+			Country *country = _game->getSavedGame()->getCountries()->at(entry);
+			const std::vector<int> &values = _alien ? country->getActivityAlien() : (_income ? country->getFunding() : country->getActivityXcom());
+			int divisor = _income ? 1000 : 1;
+			lines.at(entry)->clear();
+			std::vector<Sint16> newLineVector;
+			int reduction = 0;
+			for (size_t iter = 0; iter != 12; ++iter)
 			{
-				if (iter < country->getActivityXcom().size())
+				int x = 312 - (iter*17);
+				int y = 175 - (-lowerLimit / units);
+				if (iter < values.size())
 				{
-					reduction = country->getActivityXcom().at(country->getActivityXcom().size()-(1+iter)) / units;
+					reduction = (values.at(values.size()-(1+iter)) / divisor) / units;
 					y -= reduction;
-					totals[iter] += country->getActivityXcom().at(country->getActivityXcom().size()-(1+iter));
+					totals[iter] += values.at(values.size()-(1+iter)) / divisor;
 				}
-			}
 
-			if (y >=180) y = 180;
-			if (y <= 45) y = 45;
-			newLineVector.push_back(y);
+				if (y >=180) y = 180;
+				if (y <= 45) y = 45;
+				newLineVector.push_back(y);
 
-			if (newLineVector.size() > 1 && _alien)
-				_alienCountryLines.at(entry)->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), _countryToggles.at(entry)->_color+4);
-			else if (newLineVector.size() > 1 && _income)
-				_incomeLines.at(entry)->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), _countryToggles.at(entry)->_color+4);
-			else if (newLineVector.size() > 1)
-				_xcomCountryLines.at(entry)->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), _countryToggles.at(entry)->_color+4);
+				if (newLineVector.size() > 1)
+					lines.at(entry)->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), _countryToggles.at(entry)->_color+4);
 			}
-		if (_alien)
-			_alienCountryLines.at(entry)->setVisible(_countryToggles.at(entry)->_pushed);
-		else if (_income)
-			_incomeLines.at(entry)->setVisible(_countryToggles.at(entry)->_pushed);
-		else
-			_xcomCountryLines.at(entry)->setVisible(_countryToggles.at(entry)->_pushed);
+		}
+		lines.at(entry)->setVisible(_countryToggles.at(entry)->_pushed);
 	}
-	if (_alien)
-		_alienCountryLines.back()->clear();
-	else if (_income)
-		_incomeLines.back()->clear();
-	else
-		_xcomCountryLines.back()->clear();
 
 	// set up the "total" line
-	std::vector<Sint16> newLineVector;
-	Uint8 color = _game->getMod()->getInterface("graphs")->getElement("countryTotal")->color2;
-	for (int iter = 0; iter != 12; ++iter)
+	if (redraw)
 	{
-		int x = 312 - (iter*17);
-		int y = 175 - (-lowerLimit / units);
-		if (totals[iter] > 0)
+		lines.back()->clear();
+		std::vector<Sint16> newLineVector;
+		Uint8 color = _game->getMod()->getInterface("graphs")->getElement("countryTotal")->color2;
+		for (int iter = 0; iter != 12; ++iter)
 		{
-			int reduction = totals[iter] / units;
-			y -= reduction;
-		}
+			int x = 312 - (iter*17);
+			int y = 175 - (-lowerLimit / units);
+			if (totals[iter] > 0)
+			{
+				int reduction = totals[iter] / units;
+				y -= reduction;
+			}
 
-		if (y >=180) y = 180;
-		if (y <= 45) y = 45;
-		newLineVector.push_back(y);
+			if (y >=180) y = 180;
+			if (y <= 45) y = 45;
+			newLineVector.push_back(y);
 
-		if (newLineVector.size() > 1)
-		{
-			if (_alien)
-				_alienCountryLines.back()->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), color);
-			else if (_income)
-				_incomeLines.back()->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), color);
-			else
-				_xcomCountryLines.back()->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), color);
+			if (newLineVector.size() > 1)
+			{
+				lines.back()->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), color);
+			}
 		}
 	}
-	if (_alien)
-		_alienCountryLines.back()->setVisible(_countryToggles.back()->_pushed);
-	else if (_income)
-		_incomeLines.back()->setVisible(_countryToggles.back()->_pushed);
-	else
-		_xcomCountryLines.back()->setVisible(_countryToggles.back()->_pushed);
+	lines.back()->setVisible(_countryToggles.back()->_pushed);
 	updateScale(lowerLimit, upperLimit);
 	_txtFactor->setVisible(_income);
 }
@@ -962,87 +928,69 @@ void GraphsState::drawRegionLines()
 	range = upperLimit - lowerLimit;
 	double units = range / 126;
 
-	// draw region lines
+	// draw region lines, unless they're already drawn at this scale
+	std::vector<Surface *> &lines = _alien ? _alienRegionLines : _xcomRegionLines;
+	std::pair<int, int> &drawnScale = _alien ? _alienRegionScale : _xcomRegionScale;
+	bool redraw = (drawnScale != std::make_pair(lowerLimit, upperLimit));
+	drawnScale = std::make_pair(lowerLimit, upperLimit);
 	for (size_t entry = 0; entry != _game->getSavedGame()->getRegions()->size(); ++entry)
 	{
-		Region *region = _game->getSavedGame()->getRegions()->at(entry);
-		_alienRegionLines.at(entry)->clear();
-		_xcomRegionLines.at(entry)->clear();
-		std::vector<Sint16> newLineVector;
-		int reduction = 0;
-		for (size_t iter = 0; iter != 12; ++iter)
+		if (redraw)
 		{
-			int x = 312 - (iter*17);
-			int y = 175 - (-lowerLimit / units);
-			if (_alien)
-			{
-				if (iter < region->getActivityAlien().size())
-				{
-					reduction = region->getActivityAlien().at(region->getActivityAlien().size()-(1+iter)) / units;
-					y -= reduction;
-					totals[iter] += region->getActivityAlien().at(region->getActivityAlien().size()-(1+iter));
-				}
-			}
-			else
+			Region *region = _game->getSavedGame()->getRegions()->at(entry);
+			const std::vector<int> &values = _alien ? region->getActivityAlien() : region->getActivityXcom();
+			lines.at(entry)->clear();
+			std::vector<Sint16> newLineVector;
+			int reduction = 0;
+			for (size_t iter = 0; iter != 12; ++iter)
 			{
-				if (iter < region->getActivityXcom().size())
+				int x = 312 - (iter*17);
+				int y = 175 - (-lowerLimit / units);
+				if (iter < values.size())
 				{
-					reduction = region->getActivityXcom().at(region->getActivityXcom().size()-(1+iter)) / units;
+					reduction = values.at(values.size()-(1+iter)) / units;
 					y -= reduction;
-					totals[iter] += region->getActivityXcom().at(region->getActivityXcom().size()-(1+iter));
+					totals[iter] += values.at(values.size()-(1+iter));
 				}
-			}
 
-			if (y >=180) y = 180;
-			if (y <= 45) y = 45;
-			newLineVector.push_back(y);
+				if (y >=180) y = 180;
+				if (y <= 45) y = 45;
+				newLineVector.push_back(y);
 
-			if (newLineVector.size() > 1 && _alien)
-				_alienRegionLines.at(entry)->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), _regionToggles.at(entry)->_color+4);
-			else if (newLineVector.size() > 1)
-				_xcomRegionLines.at(entry)->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), _regionToggles.at(entry)->_color+4);
+				if (newLineVector.size() > 1)
+					lines.at(entry)->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), _regionToggles.at(entry)->_color+4);
+			}
 		}
-
-		if (_alien)
-			_alienRegionLines.at(entry)->setVisible(_regionToggles.at(entry)->_pushed);
-		else
-			_xcomRegionLines.at(entry)->setVisible(_regionToggles.at(entry)->_pushed);
+		lines.at(entry)->setVisible(_regionToggles.at(entry)->_pushed);
 	}
 
 	// set up the "total" line
-	if (_alien)
-		_alienRegionLines.back()->clear();
-	else
-		_xcomRegionLines.back()->clear();
-
-	Uint8 color = _game->getMod()->getInterface("graphs")->getElement("regionTotal")->color2;
-	std::vector<Sint16> newLineVector;
-	for (int iter = 0; iter != 12; ++iter)
+	if (redraw)
 	{
-		int x = 312 - (iter*17);
-		int y = 175 - (-lowerLimit / units);
-		if (totals[iter] > 0)
+		lines.back()->clear();
+		Uint8 color = _game->getMod()->getInterface("graphs")->getElement("regionTotal")->color2;
+		std::vector<Sint16> newLineVector;
+		for (int iter = 0; iter != 12; ++iter)
 		{
-			int reduction = totals[iter] / units;
-			y -= reduction;
-		}
+			int x = 312 - (iter*17);
+			int y = 175 - (-lowerLimit / units);
+			if (totals[iter] > 0)
+			{
+				int reduction = totals[iter] / units;
+				y -= reduction;
+			}
 
-		if (y >=180) y = 180;
-		if (y <= 45) y = 45;
-		newLineVector.push_back(y);
+			if (y >=180) y = 180;
+			if (y <= 45) y = 45;
+			newLineVector.push_back(y);
 
-		if (newLineVector.size() > 1)
-		{
-			if (_alien)
-				_alienRegionLines.back()->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), color);
-			else
-				_xcomRegionLines.back()->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), color);
+			if (newLineVector.size() > 1)
+			{
+				lines.back()->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), color);
+			}
 		}
 	}
-	if (_alien)
-		_alienRegionLines.back()->setVisible(_regionToggles.back()->_pushed);
-	else
-		_xcomRegionLines.back()->setVisible(_regionToggles.back()->_pushed);
+	lines.back()->setVisible(_regionToggles.back()->_pushed);
 	updateScale(lowerLimit, upperLimit);
 	_txtFactor->setVisible(false);
 }
@@ -1151,13 +1099,21 @@ void GraphsState::drawFinanceLines()
 	for (int button = 0; button != 5; ++button)
 	{
 		_financeLines.at(button)->setVisible(_financeToggles.at(button));
-		_financeLines.at(button)->clear();
 	}
+	updateScale(lowerLimit, upperLimit);
+	_txtFactor->setVisible(true);
+	// the lines are still good if the scale didn't change
+	if (_financeScale == std::make_pair(lowerLimit, upperLimit))
+	{
+		return;
+	}
+	_financeScale = std::make_pair(lowerLimit, upperLimit);
 	range = upperLimit - lowerLimit;
 	//figure out how many units to the pixel, then plot the points for the graph and connect the dots.
 	double units = range / 126;
 	for (int button = 0; button != 5; ++button)
 	{
+		_financeLines.at(button)->clear();
 		std::vector<Sint16> newLineVector;
 		for (int iter = 0; iter != 12; ++iter)
 		{
@@ -1189,8 +1145,6 @@ void GraphsState::drawFinanceLines()
 				_financeLines.at(button)->drawLine(x, y, x+17, newLineVector.at(newLineVector.size()-2), Palette::blockOffset((button/2)+1)+offset);
 		}
 	}
-	updateScale(lowerLimit, upperLimit);
-	_txtFactor->setVisible(true);
 }
 
 /**
@@ -58,6 +58,8 @@ private:
 	//will be only between 0 and size()
 	size_t _butRegionsOffset, _butCountriesOffset;
 	int _zoom;
+	/// Scale each set of lines was last drawn at, (0, 0) if not drawn yet.
+	std::pair<int, int> _alienRegionScale, _xcomRegionScale, _alienCountryScale, _xcomCountryScale, _incomeScale, _financeScale;
 	//scroll and repaint buttons functions
 	void scrollButtons(std::vector<GraphButInfo *> &toggles, std::vector<ToggleTextButton *> &buttons, size_t &offset, int step);
 	void updateButton(GraphButInfo *from,ToggleTextButton *to);
@@ -129,10 +129,10 @@ InterceptState::InterceptState(Globe *globe, Base *base, Target *target) : _glob
 		for (std::vector<Craft*>::iterator j = (*i)->getCrafts()->begin(); j != (*i)->getCrafts()->end(); ++j)
 		{
 			std::ostringstream ssStatus;
-			std::string status = (*j)->getStatus();
+			CraftStatus status = (*j)->getStatus();
 
 			bool hasEnoughPilots = (*j)->arePilotsOnboard();
-			if (status == "STR_OUT")
+			if (status == CRAFT_OUT)
 			{
 				// QoL: let's give the player a bit more info
 				if ((*j)->getDestination() == 0 || (*j)->getIsAutoPatrolling())
@@ -176,22 +176,22 @@ InterceptState::InterceptState(Globe *globe, Base *base, Target *target) : _glob
 					}
 					else
 					{
-						ssStatus << tr(status); // "STR_OUT"
+						ssStatus << tr((*j)->getStatusString()); // "STR_OUT"
 					}
 				}
 			}
 			else
 			{
-				if (!hasEnoughPilots && status == "STR_READY")
+				if (!hasEnoughPilots && status == CRAFT_READY)
 				{
 					ssStatus << tr("STR_PILOT_MISSING");
 				}
 				else
 				{
-					ssStatus << tr(status);
+					ssStatus << tr((*j)->getStatusString());
 				}
 			}
-			if (status != "STR_READY" && status != "STR_OUT")
+			if (status != CRAFT_READY && status != CRAFT_OUT)
 			{
 				unsigned int maintenanceHours = 0;
 
@@ -246,7 +246,7 @@ InterceptState::InterceptState(Globe *globe, Base *base, Target *target) : _glob
 			}
 			_crafts.push_back(*j);
 			_lstCrafts->addRow(4, (*j)->getName(_game->getLanguage()).c_str(), ssStatus.str().c_str(), (*i)->getName().c_str(), ss.str().c_str());
-			if (hasEnoughPilots && status == "STR_READY")
+			if (hasEnoughPilots && status == CRAFT_READY)
 			{
 				_lstCrafts->setCellColor(row, 1, _lstCrafts->getSecondaryColor());
 			}
@@ -289,7 +289,7 @@ void InterceptState::btnGotoBaseClick(Action *)
 void InterceptState::lstCraftsLeftClick(Action *)
 {
 	Craft* c = _crafts[_lstCrafts->getSelectedRow()];
-	if (c->getStatus() == "STR_READY" || ((c->getStatus() == "STR_OUT" || Options::craftLaunchAlways) && !c->getLowFuel() && !c->getMissionComplete()))
+	if (c->getStatus() == CRAFT_READY || ((c->getStatus() == CRAFT_OUT || Options::craftLaunchAlways) && !c->getLowFuel() && !c->getMissionComplete()))
 	{
 		_game->popState();
 		if (_target == 0)
@@ -310,7 +310,7 @@ void InterceptState::lstCraftsLeftClick(Action *)
 void InterceptState::lstCraftsRightClick(Action *)
 {
 	Craft* c = _crafts[_lstCrafts->getSelectedRow()];
-	if (c->getStatus() == "STR_OUT")
+	if (c->getStatus() == CRAFT_OUT)
 	{
 		_globe->center(c->getLongitude(), c->getLatitude());
 		_game->popState();
@@ -35,7 +35,7 @@ namespace OpenXcom
  * @param x X position in pixels.
  * @param y Y position in pixels.
  */
-Text::Text(int width, int height, int x, int y) : InteractiveSurface(width, height, x, y), _big(0), _small(0), _font(0), _lang(0), _wrap(false), _invert(false), _contrast(false), _indent(false), _ignoreSeparators(false), _align(ALIGN_LEFT), _valign(ALIGN_TOP), _color(0), _color2(0)
+Text::Text(int width, int height, int x, int y) : InteractiveSurface(width, height, x, y), _big(0), _small(0), _font(0), _lang(0), _wrap(false), _invert(false), _contrast(false), _indent(false), _ignoreSeparators(false), _align(ALIGN_LEFT), _valign(ALIGN_TOP), _color(0), _color2(0), _processedWidth(-1)
 {
 }
 
@@ -98,8 +98,12 @@ void Text::initText(Font *big, Font *small, Language *lang)
  */
 void Text::setText(const std::string &text)
 {
-	_text = text;
-	processText();
+	// Counters and clocks set the same text over and over, don't lay it out again
+	if (text != _text || _processedWidth != getWidth())
+	{
+		_text = text;
+		processText();
+	}
 	// If big text won't fit the space, try small text
 	if (_font == _big && (getTextWidth() > getWidth() || getTextHeight() > getHeight()) && _text[_text.size()-1] != '.')
 	{
@@ -307,6 +311,7 @@ void Text::processText()
 	}
 
 	_processedText = Unicode::convUtf8ToUtf32(_text);
+	_processedWidth = getWidth();
 	_lineWidth.clear();
 	_lineHeight.clear();
 
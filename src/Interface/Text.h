@@ -49,6 +49,7 @@ private:
 	TextHAlign _align;
 	TextVAlign _valign;
 	Uint8 _color, _color2;
+	int _processedWidth;
 
 	/// Processes the contained text.
 	void processText();
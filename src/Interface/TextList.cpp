@@ -62,12 +62,10 @@ TextList::TextList(int width, int height, int x, int y) : InteractiveSurface(wid
  */
 TextList::~TextList()
 {
-	for (std::vector< std::vector<Text*> >::iterator u = _texts.begin(); u < _texts.end(); ++u)
+	clearRendered();
+	for (std::map<int, Text*>::iterator i = _measure.begin(); i != _measure.end(); ++i)
 	{
-		for (std::vector<Text*>::iterator v = (*u).begin(); v < (*u).end(); ++v)
-		{
-			delete *v;
-		}
+		delete i->second;
 	}
 	for (std::vector<ArrowButton*>::iterator i = _arrowLeft.begin(); i < _arrowLeft.end(); ++i)
 	{
@@ -146,6 +144,17 @@ void TextList::unpress(State *state)
 	}
 }
 
+/**
+ * Returns the text color of a specific Text object in the list.
+ * @param row Row number.
+ * @param column Column number.
+ * @return Text color.
+ */
+Uint8 TextList::getCellColor(size_t row, size_t column) const
+{
+	return _texts[row].cells[column].color;
+}
+
 /**
  * Changes the color of a specific Text object in the list.
  * @param row Row number.
@@ -154,7 +163,8 @@ void TextList::unpress(State *state)
  */
 void TextList::setCellColor(size_t row, size_t column, Uint8 color)
 {
-	_texts[row][column]->setColor(color);
+	_texts[row].cells[column].color = color;
+	clearRendered(row);
 	_redraw = true;
 }
 
@@ -165,10 +175,11 @@ void TextList::setCellColor(size_t row, size_t column, Uint8 color)
  */
 void TextList::setRowColor(size_t row, Uint8 color)
 {
-	for (std::vector<Text*>::iterator i = _texts[row].begin(); i < _texts[row].end(); ++i)
+	for (std::vector<Cell>::iterator i = _texts[row].cells.begin(); i < _texts[row].cells.end(); ++i)
 	{
-		(*i)->setColor(color);
+		i->color = color;
 	}
+	clearRendered(row);
 	_redraw = true;
 }
 
@@ -180,7 +191,7 @@ void TextList::setRowColor(size_t row, Uint8 color)
  */
 std::string TextList::getCellText(size_t row, size_t column) const
 {
-	return _texts[row][column]->getText();
+	return _texts[row].cells[column].text;
 }
 
 /**
@@ -191,7 +202,34 @@ std::string TextList::getCellText(size_t row, size_t column) const
  */
 void TextList::setCellText(size_t row, size_t column, const std::string &text)
 {
-	_texts[row][column]->setText(text);
+	Row &r = _texts[row];
+	Cell &cell = r.cells[column];
+
+	// the new text might not fit in the big font anymore
+	Text *txt = getMeasureText(cell.width);
+	txt->setHeight(r.height);
+	if (cell.wrap)
+	{
+		txt->setWordWrap(true, true, cell.ignoreSeparators);
+	}
+	if (cell.big)
+	{
+		txt->setBig();
+	}
+	else
+	{
+		txt->setSmall();
+	}
+	txt->setText(text);
+
+	cell.text = text;
+	cell.big = (txt->getFont() == _big);
+	if (column == 0)
+	{
+		r.textHeight = txt->getTextHeight();
+		r.lines = txt->getNumLines();
+	}
+	clearRendered(row);
 	_redraw = true;
 }
 
@@ -202,7 +240,7 @@ void TextList::setCellText(size_t row, size_t column, const std::string &text)
  */
 int TextList::getColumnX(size_t column) const
 {
-	return getX() + _texts[0][column]->getX();
+	return getX() + _texts[0].cells[column].x;
 }
 
 /**
@@ -212,7 +250,7 @@ int TextList::getColumnX(size_t column) const
  */
 int TextList::getRowY(size_t row) const
 {
-	return getY() + _texts[row][0]->getY();
+	return getY() + _texts[row].y;
 }
 
 /**
@@ -222,7 +260,7 @@ int TextList::getRowY(size_t row) const
  */
 int TextList::getTextHeight(size_t row) const
 {
-	return _texts[row].front()->getTextHeight();
+	return _texts[row].textHeight;
 }
 
 /**
@@ -232,7 +270,7 @@ int TextList::getTextHeight(size_t row) const
  */
 int TextList::getNumTextLines(size_t row) const
 {
-	return _texts[row].front()->getNumLines();
+	return _texts[row].lines;
 }
 
 /**
@@ -244,6 +282,17 @@ size_t TextList::getTexts() const
 	return _texts.size();
 }
 
+/**
+ * Returns the amount of cells in a row of the list,
+ * which can be less than the columns for flooding rows.
+ * @param row Row number.
+ * @return Number of cells.
+ */
+size_t TextList::getCells(size_t row) const
+{
+	return _texts[row].cells.size();
+}
+
 /**
  * Returns the amount of physical rows stored in the list.
  * @return Number of rows.
@@ -282,12 +331,12 @@ void TextList::addRow(int cols, ...)
 		ncols = 1;
 	}
 
-	std::vector<Text*> temp;
+	Row temp;
 	// Positions are relative to list surface.
 	int rowX = 0, rowY = 0, rows = 1, rowHeight = 0;
 	if (!_texts.empty())
 	{
-		rowY = _texts.back().front()->getY() + _texts.back().front()->getHeight() + _font->getSpacing();
+		rowY = _texts.back().y + _texts.back().height + _font->getSpacing();
 	}
 
 	for (int i = 0; i < ncols; ++i)
@@ -302,16 +351,8 @@ void TextList::addRow(int cols, ...)
 		{
 			width = _columns[i];
 		}
-		Text* txt = new Text(width, _font->getHeight(), _margin + rowX, rowY);
-		txt->setPalette(this->getPalette());
-		txt->initText(_big, _small, _lang);
-		txt->setColor(_color);
-		txt->setSecondaryColor(_color2);
-		if (_align[i])
-		{
-			txt->setAlign(_align[i]);
-		}
-		txt->setHighContrast(_contrast);
+		// Only measure the text here, it's rendered when it comes into view
+		Text* txt = getMeasureText(width);
 		if (_font == _big)
 		{
 			txt->setBig();
@@ -320,16 +361,17 @@ void TextList::addRow(int cols, ...)
 		{
 			txt->setSmall();
 		}
-		if (cols > 0)
-			txt->setText(va_arg(args, char*));
+		txt->setText(cols > 0 ? va_arg(args, char*) : "");
 		// grab this before we enable word wrapping so we can use it to calculate
 		// the total row height below
 		int vmargin = _font->getHeight() - txt->getTextHeight();
 		// Wordwrap text if necessary
+		bool wrap = false;
 		if (_wrap && txt->getTextWidth() > txt->getWidth())
 		{
 			txt->setWordWrap(true, true, _ignoreSeparators);
 			rows = std::max(rows, txt->getNumLines());
+			wrap = true;
 		}
 		rowHeight = std::max(rowHeight, txt->getTextHeight() + vmargin);
 
@@ -354,7 +396,22 @@ void TextList::addRow(int cols, ...)
 			txt->setText(buf);
 		}
 
-		temp.push_back(txt);
+		Cell cell;
+		cell.text = txt->getText();
+		cell.x = _margin + rowX;
+		cell.width = width;
+		cell.color = _color;
+		cell.color2 = _color2;
+		cell.align = _align[i];
+		cell.big = (txt->getFont() == _big);
+		cell.wrap = wrap;
+		cell.ignoreSeparators = _ignoreSeparators;
+		temp.cells.push_back(cell);
+		if (i == 0)
+		{
+			temp.textHeight = txt->getTextHeight();
+			temp.lines = txt->getNumLines();
+		}
 		if (_condensed)
 		{
 			rowX += txt->getTextWidth();
@@ -365,11 +422,9 @@ void TextList::addRow(int cols, ...)
 		}
 	}
 
-	// ensure all elements in this row are the same height
-	for (int i = 0; i < cols; ++i)
-	{
-		temp[i]->setHeight(rowHeight);
-	}
+	// all elements in this row are the same height
+	temp.y = rowY;
+	temp.height = (cols > 0) ? rowHeight : _font->getHeight();
 
 	_texts.push_back(temp);
 	for (int i = 0; i < rows; ++i)
@@ -422,6 +477,7 @@ void TextList::removeLastRow()
 {
 	if (!_texts.empty())
 	{
+		clearRendered(_texts.size() - 1);
 		_texts.pop_back();
 	}
 	if (!_rows.empty())
@@ -478,9 +534,9 @@ void TextList::setColumns(int cols, ...)
 void TextList::setPalette(const SDL_Color *colors, int firstcolor, int ncolors)
 {
 	Surface::setPalette(colors, firstcolor, ncolors);
-	for (std::vector< std::vector<Text*> >::iterator u = _texts.begin(); u < _texts.end(); ++u)
+	for (std::map<size_t, std::vector<Text*> >::iterator u = _rendered.begin(); u != _rendered.end(); ++u)
 	{
-		for (std::vector<Text*>::iterator v = u->begin(); v < u->end(); ++v)
+		for (std::vector<Text*>::iterator v = u->second.begin(); v < u->second.end(); ++v)
 		{
 			(*v)->setPalette(colors, firstcolor, ncolors);
 		}
@@ -516,6 +572,13 @@ void TextList::initText(Font *big, Font *small, Language *lang)
 	_font = small;
 	_lang = lang;
 
+	clearRendered();
+	for (std::map<int, Text*>::iterator i = _measure.begin(); i != _measure.end(); ++i)
+	{
+		delete i->second;
+	}
+	_measure.clear();
+
 	delete _selector;
 	_selector = new Surface(getWidth(), _font->getHeight() + _font->getSpacing(), getX(), getY());
 	_selector->setPalette(getPalette());
@@ -549,9 +612,16 @@ void TextList::setColor(Uint8 color)
 	_up->setColor(color);
 	_down->setColor(color);
 	_scrollbar->setColor(color);
-	for (std::vector< std::vector<Text*> >::iterator u = _texts.begin(); u < _texts.end(); ++u)
+	for (std::vector<Row>::iterator u = _texts.begin(); u < _texts.end(); ++u)
 	{
-		for (std::vector<Text*>::iterator v = u->begin(); v < u->end(); ++v)
+		for (std::vector<Cell>::iterator v = u->cells.begin(); v < u->cells.end(); ++v)
+		{
+			v->color = color;
+		}
+	}
+	for (std::map<size_t, std::vector<Text*> >::iterator u = _rendered.begin(); u != _rendered.end(); ++u)
+	{
+		for (std::vector<Text*>::iterator v = u->second.begin(); v < u->second.end(); ++v)
 		{
 			(*v)->setColor(color);
 		}
@@ -604,9 +674,9 @@ void TextList::setWordWrap(bool wrap)
 void TextList::setHighContrast(bool contrast)
 {
 	_contrast = contrast;
-	for (std::vector< std::vector<Text*> >::iterator u = _texts.begin(); u < _texts.end(); ++u)
+	for (std::map<size_t, std::vector<Text*> >::iterator u = _rendered.begin(); u != _rendered.end(); ++u)
 	{
-		for (std::vector<Text*>::iterator v = u->begin(); v < u->end(); ++v)
+		for (std::vector<Text*>::iterator v = u->second.begin(); v < u->second.end(); ++v)
 		{
 			(*v)->setHighContrast(contrast);
 		}
@@ -848,14 +918,7 @@ void TextList::onRightArrowRelease(ActionHandler handler)
  */
 void TextList::clearList()
 {
-	for (std::vector< std::vector<Text*> >::iterator u = _texts.begin(); u < _texts.end(); ++u)
-	{
-		for (std::vector<Text*>::iterator v = u->begin(); v < u->end(); ++v)
-		{
-			delete (*v);
-		}
-		u->clear();
-	}
+	clearRendered();
 	scrollUp(true, false);
 	_texts.clear();
 	_rows.clear();
@@ -979,23 +1042,128 @@ void TextList::draw()
 		{
 			y -= _font->getHeight() + _font->getSpacing();
 		}
-		for (size_t i = _rows[_scroll]; i < _texts.size() && i < _rows[_scroll] + _visibleRows; ++i)
+		size_t first = _rows[_scroll], last = first;
+		for (size_t i = first; i < _texts.size() && i < first + _visibleRows; ++i)
 		{
-			for (std::vector<Text*>::iterator j = _texts[i].begin(); j < _texts[i].end(); ++j)
+			_texts[i].y = y;
+			const std::vector<Text*> &texts = renderRow(i);
+			for (std::vector<Text*>::const_iterator j = texts.begin(); j < texts.end(); ++j)
 			{
 				(*j)->setY(y);
 				(*j)->blit(this->getSurface());
 			}
-			if (!_texts[i].empty())
+			y += _texts[i].height + _font->getSpacing();
+			last = i;
+		}
+
+		// keep the rows around the visible ones for scrolling, drop the rest
+		for (std::map<size_t, std::vector<Text*> >::iterator i = _rendered.begin(); i != _rendered.end();)
+		{
+			if (i->first + _visibleRows < first || i->first > last + _visibleRows)
 			{
-				y += _texts[i].front()->getHeight() + _font->getSpacing();
+				for (std::vector<Text*>::iterator j = i->second.begin(); j < i->second.end(); ++j)
+				{
+					delete *j;
+				}
+				i = _rendered.erase(i);
 			}
 			else
 			{
-				y += _font->getHeight() + _font->getSpacing();
+				++i;
+			}
+		}
+	}
+}
+
+/**
+ * Gets the text used to measure the cells of a given width,
+ * so rows can be laid out without rendering anything.
+ * @param width Width of the cells.
+ * @return Text with no wordwrapping.
+ */
+Text *TextList::getMeasureText(int width)
+{
+	Text *&txt = _measure[width];
+	if (txt == 0)
+	{
+		txt = new Text(width, _font->getHeight());
+		txt->initText(_big, _small, _lang);
+	}
+	else if (txt->getHeight() != _font->getHeight())
+	{
+		txt->setHeight(_font->getHeight());
+	}
+	txt->setWordWrap(false);
+	return txt;
+}
+
+/**
+ * Gets the texts of a row, creating them from the
+ * laid out cells if the row wasn't rendered yet.
+ * @param row Row number.
+ * @return Texts of each cell.
+ */
+const std::vector<Text*> &TextList::renderRow(size_t row)
+{
+	std::vector<Text*> &texts = _rendered[row];
+	if (texts.empty())
+	{
+		const Row &r = _texts[row];
+		for (std::vector<Cell>::const_iterator i = r.cells.begin(); i < r.cells.end(); ++i)
+		{
+			Text *txt = new Text(i->width, r.height, i->x, r.y);
+			txt->setPalette(this->getPalette());
+			txt->initText(_big, _small, _lang);
+			txt->setColor(i->color);
+			txt->setSecondaryColor(i->color2);
+			txt->setAlign(i->align);
+			txt->setHighContrast(_contrast);
+			txt->setText(i->text);
+			if (i->wrap)
+			{
+				txt->setWordWrap(true, true, i->ignoreSeparators);
+			}
+			if (i->big)
+			{
+				txt->setBig();
 			}
+			texts.push_back(txt);
+		}
+	}
+	return texts;
+}
+
+/**
+ * Drops the rendered texts of a row, so they're
+ * created again with its new contents.
+ * @param row Row number.
+ */
+void TextList::clearRendered(size_t row)
+{
+	std::map<size_t, std::vector<Text*> >::iterator i = _rendered.find(row);
+	if (i != _rendered.end())
+	{
+		for (std::vector<Text*>::iterator j = i->second.begin(); j < i->second.end(); ++j)
+		{
+			delete *j;
+		}
+		_rendered.erase(i);
+	}
+}
+
+/**
+ * Drops the rendered texts of all rows.
+ */
+void TextList::clearRendered()
+{
+	for (std::map<size_t, std::vector<Text*> >::iterator i = _rendered.begin(); i != _rendered.end(); ++i)
+	{
+		for (std::vector<Text*>::iterator j = i->second.begin(); j < i->second.end(); ++j)
+		{
+			delete *j;
 		}
 	}
+	_rendered.clear();
 }
 
 /**
@@ -1031,14 +1199,7 @@ void TextList::blit(SDL_Surface *surface)
 					_arrowRight[i]->blit(surface);
 				}
 
-				if (!_texts[i].empty())
-				{
-					y += _texts[i].front()->getHeight() + _font->getSpacing();
-				}
-				else
-				{
-					y += _font->getHeight() + _font->getSpacing();
-				}
+				y += _texts[i].height + _font->getSpacing();
 			}
 		}
 		_up->blit(surface);
@@ -1190,9 +1351,9 @@ void TextList::mouseOver(Action *action, State *state)
 		_selRow = std::max(0, (int)(_scroll + (int)floor(action->getRelativeYMouse() / (rowHeight * action->getYScale()))));
 		if (_selRow < _rows.size())
 		{
-			Text *selText = _texts[_rows[_selRow]].front();
-			int y = getY() + selText->getY();
-			int actualHeight = selText->getHeight() + _font->getSpacing(); //current line height
+			const Row &selText = _texts[_rows[_selRow]];
+			int y = getY() + selText.y;
+			int actualHeight = selText.height + _font->getSpacing(); //current line height
 			if (y < getY() || y + actualHeight > getY() + getHeight())
 			{
 				actualHeight /= 2;
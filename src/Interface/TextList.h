@@ -36,11 +36,31 @@ class ScrollBar;
  * Contains a set of Text's that are automatically lined up by
  * rows and columns, like a big table, making it easy to manage
  * them together.
+ * Only the strings and layout of each row are kept, the actual
+ * Text's are only created for the rows around the visible ones.
  */
 class TextList : public InteractiveSurface
 {
 private:
-	std::vector< std::vector<Text*> > _texts;
+	/// Text of a cell, laid out but not rendered.
+	struct Cell
+	{
+		std::string text;
+		int x, width;
+		Uint8 color, color2;
+		TextHAlign align;
+		bool big, wrap, ignoreSeparators;
+	};
+	/// Cells of a row and where they go.
+	struct Row
+	{
+		std::vector<Cell> cells;
+		int y, height, textHeight, lines;
+	};
+
+	std::vector<Row> _texts;
+	std::map<int, Text*> _measure;
+	std::map<size_t, std::vector<Text*> > _rendered;
 	std::vector<size_t> _columns, _rows;
 	Font *_big, *_small, *_font;
 	Language *_lang;
@@ -64,6 +84,14 @@ private:
 	void updateArrows();
 	/// Updates the visible rows.
 	void updateVisible();
+	/// Gets a text for measuring cells of a given width.
+	Text *getMeasureText(int width);
+	/// Gets the texts of a row, rendering them if needed.
+	const std::vector<Text*> &renderRow(size_t row);
+	/// Drops the rendered texts of a row.
+	void clearRendered(size_t row);
+	/// Drops all the rendered texts.
+	void clearRendered();
 public:
 	/// Creates a text list with the specified size and position.
 	TextList(int width, int height, int x = 0, int y = 0);
@@ -79,6 +107,8 @@ public:
 	int getArrowsRightEdge();
 	/// Unpresses the surface.
 	void unpress(State *state) override;
+	/// Gets the text color of a certain cell.
+	Uint8 getCellColor(size_t row, size_t column) const;
 	/// Sets the text color of a certain cell.
 	void setCellColor(size_t row, size_t column, Uint8 color);
 	/// Sets the text color of a certain row.
@@ -97,6 +127,8 @@ public:
 	int getNumTextLines(size_t row) const;
 	/// Gets the amount of text in the list.
 	size_t getTexts() const;
+	/// Gets the amount of cells in a row of the list.
+	size_t getCells(size_t row) const;
 	/// Gets the amount of rows in the list.
 	size_t getRows() const;
 	/// Gets the amount of visible rows in the list.
@@ -159,6 +159,13 @@ void LoadGameState::think()
 			origBattleState = _game->getSavedGame()->getSavedBattle()->getBattleState();
 		}
 
+		// The file might still be getting written by an autosave
+		std::string pending = SavedGame::waitForBackgroundSave();
+		if (!pending.empty())
+		{
+			Log(LOG_ERROR) << pending;
+		}
+
 		// Load the game
 		SavedGame *s = new SavedGame();
 		try
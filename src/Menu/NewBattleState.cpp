@@ -329,7 +329,7 @@ void NewBattleState::load(const std::string &filename)
 				{
 					std::string craftType = _crafts[_cbxCraft->getSelected()];
 					_craft = new Craft(_game->getMod()->getCraft(craftType), base, save->getId(craftType));
-					base->getCrafts()->push_back(_craft);
+					base->addCraft(_craft);
 				}
 				else
 				{
@@ -401,12 +401,16 @@ void NewBattleState::initSave()
 	// Kill everything we don't want in this base
 	for (std::vector<Soldier*>::iterator i = base->getSoldiers()->begin(); i != base->getSoldiers()->end(); ++i) delete (*i);
 	base->getSoldiers()->clear();
-	for (std::vector<Craft*>::iterator i = base->getCrafts()->begin(); i != base->getCrafts()->end(); ++i) delete (*i);
-	base->getCrafts()->clear();
+	while (!base->getCrafts()->empty())
+	{
+		Craft *craft = base->getCrafts()->back();
+		base->removeCraft(craft, false);
+		delete craft;
+	}
 	base->getStorageItems()->getContents()->clear();
 
 	_craft = new Craft(mod->getCraft(_crafts[_cbxCraft->getSelected()]), base, 1);
-	base->getCrafts()->push_back(_craft);
+	base->addCraft(_craft);
 
 	// Generate soldiers
 	for (int i = 0; i < 30; ++i)
@@ -155,6 +155,31 @@ void SaveGameState::think()
 			break;
 		}
 
+		// Only one save at a time, finish the autosave still being written
+		std::string pending = SavedGame::waitForBackgroundSave();
+		if (!pending.empty())
+		{
+			error(pending);
+		}
+
+		// Autosaves are written in the background, so they don't hold up the game
+		if (_type == SAVE_AUTO_GEOSCAPE || _type == SAVE_AUTO_BATTLESCAPE)
+		{
+			try
+			{
+				_game->getSavedGame()->saveInBackground(_filename, _game->getMod());
+			}
+			catch (Exception &e)
+			{
+				error(e.what());
+			}
+			catch (YAML::Exception &e)
+			{
+				error(e.what());
+			}
+			return;
+		}
+
 		// Save the game
 		try
 		{
@@ -193,6 +193,54 @@ Surface *ExtraSprites::loadSurface(Surface *surface)
 	return surface;
 }
 
+/**
+ * Returns the image files in a folder, filtered and
+ * sorted in the order they are loaded as frames.
+ * @param folder Folder path, ending with a slash.
+ * @return List of filenames inside the folder.
+ */
+std::vector<std::string> ExtraSprites::getFolderImages(const std::string &folder)
+{
+	std::vector<std::string> contents;
+	for (auto f: FileMap::getVFolderContents(folder))
+	{
+		if (isImageFile(f))
+		{
+			contents.push_back(f);
+		}
+	}
+	std::sort(contents.begin(), contents.end(), Unicode::naturalCompare);
+	return contents;
+}
+
+/**
+ * Adds the full paths of all the image files
+ * this sprite loads to a list.
+ * @param files List to add the filenames to.
+ */
+void ExtraSprites::getImageFiles(std::vector<std::string> &files) const
+{
+	for (std::map<int, std::string>::const_iterator j = _sprites.begin(); j != _sprites.end(); ++j)
+	{
+		const std::string &fileName = j->second;
+		if (!_singleImage && fileName[fileName.length() - 1] == '/')
+		{
+			for (const auto &f : getFolderImages(fileName))
+			{
+				files.push_back(fileName + f);
+			}
+		}
+		else
+		{
+			files.push_back(fileName);
+		}
+		if (_singleImage)
+		{
+			break;
+		}
+	}
+}
+
 /**
  * Loads the external sprite into a new or existing surface set.
  * @param set Existing surface set.
@@ -232,13 +280,9 @@ SurfaceSet *ExtraSprites::loadSurfaceSet(SurfaceSet *set)
 		{
 			Log(LOG_VERBOSE) << "Loading surface set from folder: " << fileName << " starting at frame: " << startFrame;
 			int offset = startFrame;
-			std::vector<std::string> contents;
-			for (auto f: FileMap::getVFolderContents(fileName)) { contents.push_back(f); }
-			std::sort(contents.begin(), contents.end(), Unicode::naturalCompare);
+			std::vector<std::string> contents = getFolderImages(fileName);
 			for (auto k = contents.begin(); k != contents.end(); ++k)
 			{
-				if (!isImageFile(*k))
-					continue;
 				try
 				{
 					getFrame(set, offset)->loadImage(fileName + *k);
@@ -20,6 +20,7 @@
 #include <yaml-cpp/yaml.h>
 #include <string>
 #include <map>
+#include <vector>
 
 namespace OpenXcom
 {
@@ -43,6 +44,8 @@ private:
 	bool _loaded;
 
 	Surface *getFrame(SurfaceSet *set, int index) const;
+	/// Gets the image files in a folder, in load order.
+	static std::vector<std::string> getFolderImages(const std::string &folder);
 public:
 	/// Creates a blank external sprite set.
 	ExtraSprites();
@@ -68,6 +71,8 @@ public:
 	bool isLoaded() const;
 	/// Checks if a filename is a valid image file.
 	static bool isImageFile(const std::string &filename);
+	/// Gets the image files this sprite will load.
+	void getImageFiles(std::vector<std::string> &files) const;
 	/// Load the external sprite into a surface.
 	Surface *loadSurface(Surface *surface);
 	/// Load the external sprite into a surface set.
@@ -20,6 +20,7 @@
 #include "ModScript.h"
 #include <algorithm>
 #include <sstream>
+#include <iterator>
 #include <climits>
 #include <unordered_map>
 #include <cassert>
@@ -27,6 +28,7 @@
 #include "../Engine/FileMap.h"
 #include "../Engine/SDL2Helpers.h"
 #include "../Engine/Palette.h"
+#include "../Engine/PaletteMatcher.h"
 #include "../Engine/Font.h"
 #include "../Engine/Surface.h"
 #include "../Engine/SurfaceSet.h"
@@ -44,6 +46,9 @@
 #include "../Engine/Logger.h"
 #include "../Engine/ScriptBind.h"
 #include "../Engine/Collections.h"
+#include "../Engine/Parallel.h"
+#include "../Engine/RulesetCache.h"
+#include "../Engine/YamlBinary.h"
 #include "SoundDefinition.h"
 #include "ExtraSprites.h"
 #include "CustomPalettes.h"
@@ -747,10 +752,20 @@ void Mod::lazyLoadSurface(const std::string &name)
 		std::map<std::string, std::vector<ExtraSprites *> >::const_iterator i = _extraSprites.find(name);
 		if (i != _extraSprites.end())
 		{
+			std::vector<std::string> files;
+			for (std::vector<ExtraSprites*>::const_iterator j = i->second.begin(); j != i->second.end(); ++j)
+			{
+				if (!(*j)->isLoaded())
+				{
+					(*j)->getImageFiles(files);
+				}
+			}
+			Surface::preloadImages(files);
 			for (std::vector<ExtraSprites*>::const_iterator j = i->second.begin(); j != i->second.end(); ++j)
 			{
 				loadExtraSprite(*j);
 			}
+			Surface::clearPreloadedImages();
 		}
 	}
 }
@@ -1300,6 +1315,9 @@ void Mod::loadAll()
 	_soundOffsetBattle = _sounds["BATTLE.CAT"]->getMaxSharedSounds();
 	_soundOffsetGeo = _sounds["GEO.CAT"]->getMaxSharedSounds();
 
+	// parse rest rulesets, this doesn't depend on anything loaded before
+	auto parsed = parseRulesets(mods);
+
 	// load rest rulesets
 	for (size_t i = 0; mods.size() > i; ++i)
 	{
@@ -1307,7 +1325,7 @@ void Mod::loadAll()
 		{
 			_modCurrent = &_modData.at(i);
 			_scriptGlobal->setMod((int)_modCurrent->offset);
-			loadMod(mods[i].second, parser);
+			loadMod(mods[i].second, parsed[i], parser);
 		}
 		catch (Exception &e)
 		{
@@ -1367,6 +1385,7 @@ void Mod::loadAll()
 	afterLoadHelper("enviroEffects", this, _enviroEffects, &RuleEnviroEffects::afterLoad);
 	afterLoadHelper("commendations", this, _commendations, &RuleCommendations::afterLoad);
 	afterLoadHelper("skills", this, _skills, &RuleSkill::afterLoad);
+	_globe->afterLoad();
 
 	// auto-create alternative manufacture rules
 	for (auto shortcutPair : _manufactureShortcut)
@@ -1414,24 +1433,138 @@ void Mod::loadAll()
 	modResources();
 }
 
+/**
+ * Parses the ruleset files of all mods into YAML documents.
+ * Files are read one by one (zipped mods can't be read concurrently),
+ * then parsed on worker threads. Files that didn't change since the
+ * last run are rebuilt from the binary ruleset cache instead of parsed.
+ * Parse errors are kept with the file so they are reported when the
+ * file is loaded, in the usual order.
+ * @param mods List of ruleset files of each mod.
+ * @return Parsed documents, in the same order as the files.
+ */
+std::vector<std::vector<Mod::ParsedRuleset>> Mod::parseRulesets(const FileMap::RSOrder &mods)
+{
+	std::vector<std::vector<ParsedRuleset>> parsed(mods.size());
+	std::vector<ParsedRuleset*> files;
+	std::vector<const FileMap::FileRecord*> records;
+	std::vector<std::string> texts;
+	for (size_t i = 0; i < mods.size(); ++i)
+	{
+		parsed[i].resize(mods[i].second.size());
+		for (size_t j = 0; j < mods[i].second.size(); ++j)
+		{
+			files.push_back(&parsed[i][j]);
+			records.push_back(&mods[i].second[j]);
+			texts.emplace_back();
+			try
+			{
+				auto stream = mods[i].second[j].getIStream();
+				texts.back().assign(std::istreambuf_iterator<char>(*stream), std::istreambuf_iterator<char>());
+			}
+			catch (...)
+			{
+				parsed[i][j].error = std::current_exception();
+			}
+		}
+	}
+
+	const std::string cacheFile = Options::getUserFolder() + "rulesets.cache";
+	const RulesetCache::Entries cache = RulesetCache::load(cacheFile);
+	std::vector<RulesetCache::Entry> entries(files.size());
+	std::vector<char> cached(files.size(), false);
+
+	parallelFor(files.size(), [&](size_t i)
+	{
+		if (files[i]->error)
+		{
+			return;
+		}
+		entries[i].hash = RulesetCache::hash(texts[i]);
+		auto c = cache.find(records[i]->fullpath);
+		if (c != cache.end() && c->second.hash == entries[i].hash)
+		{
+			try
+			{
+				files[i]->doc = YamlBinary::decode(c->second.data);
+				files[i]->cached = true;
+				entries[i].data = c->second.data;
+				cached[i] = true;
+				return;
+			}
+			catch (std::exception &)
+			{
+				// damaged entry, parse the file again
+			}
+		}
+		try
+		{
+			files[i]->doc = YAML::Load(texts[i]);
+			entries[i].data = YamlBinary::encode(files[i]->doc);
+		}
+		catch (...)
+		{
+			files[i]->error = std::current_exception();
+		}
+		std::string().swap(texts[i]);
+	});
+
+	// only rewrite the cache when something changed
+	bool changed = cache.size() != files.size();
+	RulesetCache::Entries update;
+	for (size_t i = 0; i < files.size(); ++i)
+	{
+		changed = changed || !cached[i];
+		if (!files[i]->error)
+		{
+			update[records[i]->fullpath] = std::move(entries[i]);
+		}
+	}
+	if (changed)
+	{
+		RulesetCache::save(cacheFile, update);
+	}
+
+	return parsed;
+}
+
 /**
  * Loads a list of rulesets from YAML files for the mod at the specified index. The first
  * mod loaded should be the master at index 0, then 1, and so on.
  * @param rulesetFiles List of rulesets to load.
+ * @param parsedFiles Parsed documents of the rulesets.
  * @param parsers Object with all available parsers.
  */
-void Mod::loadMod(const std::vector<FileMap::FileRecord> &rulesetFiles, ModScript &parsers)
+void Mod::loadMod(const std::vector<FileMap::FileRecord> &rulesetFiles, const std::vector<ParsedRuleset> &parsedFiles, ModScript &parsers)
 {
-	for (auto i = rulesetFiles.begin(); i != rulesetFiles.end(); ++i)
+	for (size_t i = 0; i < rulesetFiles.size(); ++i)
 	{
-		Log(LOG_VERBOSE) << "- " << i->fullpath;
+		const FileMap::FileRecord &filerec = rulesetFiles[i];
+		Log(LOG_VERBOSE) << "- " << filerec.fullpath;
 		try
 		{
-			loadFile(*i, parsers);
+			if (parsedFiles[i].error)
+			{
+				Log(LOG_FATAL) << "Error loading file '" << filerec.fullpath << "'";
+				std::rethrow_exception(parsedFiles[i].error);
+			}
+			loadFile(parsedFiles[i].doc, parsers);
 		}
 		catch (YAML::Exception &e)
 		{
-			throw Exception(i->fullpath + ": " + std::string(e.what()));
+			if (parsedFiles[i].cached)
+			{
+				// cached documents have no line numbers, so parse the text to report where the error is
+				try
+				{
+					loadFile(YAML::Load(*filerec.getIStream()), parsers);
+				}
+				catch (YAML::Exception &marked)
+				{
+					throw Exception(filerec.fullpath + ": " + std::string(marked.what()));
+				}
+			}
+			throw Exception(filerec.fullpath + ": " + std::string(e.what()));
 		}
 	}
 
@@ -1580,15 +1713,13 @@ void Mod::loadConstants(const YAML::Node &node)
 }
 
 /**
- * Loads a ruleset's contents from a YAML file.
+ * Loads a ruleset's contents from a YAML document.
  * Rules that match pre-existing rules overwrite them.
- * @param filename YAML filename.
+ * @param doc YAML document of the ruleset.
  * @param parsers Object with all available parsers.
  */
-void Mod::loadFile(const FileMap::FileRecord &filerec, ModScript &parsers)
+void Mod::loadFile(YAML::Node doc, ModScript &parsers)
 {
-	auto doc = filerec.getYAML();
-
 	if (const YAML::Node &extended = doc["extended"])
 	{
 		_scriptGlobal->load(extended);
@@ -4536,13 +4667,34 @@ void Mod::loadExtraResources()
 	if (!Options::lazyLoadResources)
 	{
 		Log(LOG_INFO) << "Loading extra resources from ruleset...";
+		// decode the images of a batch of sprites together on worker threads, then load them in order as usual
+		const size_t batchSize = 256;
+		std::vector<ExtraSprites*> batch;
+		std::vector<std::string> files;
+		auto loadBatch = [&]
+		{
+			Surface::preloadImages(files);
+			for (std::vector<ExtraSprites*>::const_iterator j = batch.begin(); j != batch.end(); ++j)
+			{
+				loadExtraSprite(*j);
+			}
+			Surface::clearPreloadedImages();
+			batch.clear();
+			files.clear();
+		};
 		for (std::map<std::string, std::vector<ExtraSprites *> >::const_iterator i = _extraSprites.begin(); i != _extraSprites.end(); ++i)
 		{
 			for (std::vector<ExtraSprites*>::const_iterator j = i->second.begin(); j != i->second.end(); ++j)
 			{
-				loadExtraSprite(*j);
+				(*j)->getImageFiles(files);
+				batch.push_back(*j);
+				if (files.size() >= batchSize)
+				{
+					loadBatch();
+				}
 			}
 		}
+		loadBatch();
 	}
 
 	for (std::vector< std::pair<std::string, ExtraSounds *> >::const_iterator i = _extraSounds.begin(); i != _extraSounds.end(); ++i)
@@ -4861,7 +5013,14 @@ Music *Mod::loadMusic(MusicFormat fmt, const std::string &file, size_t track, fl
 			if (soundContents.find(fname) != soundContents.end())
 			{
 				music = new Music();
-				music->load("SOUND/" + fname);
+				if (Options::lazyLoadResources)
+				{
+					music->setOnDemandFile("SOUND/" + fname);
+				}
+				else
+				{
+					music->load("SOUND/" + fname);
+				}
 			}
 		}
 	}
@@ -4876,16 +5035,16 @@ Music *Mod::loadMusic(MusicFormat fmt, const std::string &file, size_t track, fl
 
 /**
  * Preamble:
- * this is the most horrible function i've ever written, and it makes me sad.
- * this is, however, a necessary evil, in order to save massive amounts of time in the draw function.
- * when used with the default TFTD mod, this function loops 4,194,304 times
- * (4 palettes, 4 tints, 4 levels of opacity, 256 colors, 256 comparisons per)
- * each additional tint in the rulesets will result in over a million iterations more.
+ * this is a necessary evil, in order to save massive amounts of time in the draw function.
+ * when used with the default TFTD mod, this function looks up 16,384 colors per palette
+ * (4 tints, 4 levels of opacity, 256 colors), each additional tint adds 1024 more.
+ * the closest palette color is found through a PaletteMatcher grid instead of
+ * comparing against all 256 colors every time.
  * @param pal the palette to base the lookup table on.
  */
 void Mod::createTransparencyLUT(Palette *pal)
 {
-	SDL_Color desiredColor;
+	PaletteMatcher matcher(pal->getColors(), 256);
 	std::vector<Uint8> lookUpTable;
 	// start with the color sets
 	for (std::vector<SDL_Color>::const_iterator tint = _transparencies.begin(); tint != _transparencies.end(); ++tint)
@@ -4897,29 +5056,11 @@ void Mod::createTransparencyLUT(Palette *pal)
 			for (int currentColor = 0; currentColor < 256; ++currentColor)
 			{
 				// add the RGB values from the ruleset to those of the colors contained in the palette
-				// in order to determine the desired color
-				// yes all this casting and clamping is required, we're dealing with Uint8s here, and there's
-				// a lot of potential for values to wrap around, which would be very bad indeed.
-				desiredColor.r = std::min(255, (int)(pal->getColors(currentColor)->r) + (tint->r * opacity));
-				desiredColor.g = std::min(255, (int)(pal->getColors(currentColor)->g) + (tint->g * opacity));
-				desiredColor.b = std::min(255, (int)(pal->getColors(currentColor)->b) + (tint->b * opacity));
-
-				Uint8 closest = 0;
-				int lowestDifference = INT_MAX;
-				// now compare each color in the palette to find the closest match to our desired one
-				for (int comparator = 0; comparator < 256; ++comparator)
-				{
-					int currentDifference = Sqr(desiredColor.r - pal->getColors(comparator)->r) +
-						Sqr(desiredColor.g - pal->getColors(comparator)->g) +
-						Sqr(desiredColor.b - pal->getColors(comparator)->b);
-
-					if (currentDifference < lowestDifference)
-					{
-						closest = comparator;
-						lowestDifference = currentDifference;
-					}
-				}
-				lookUpTable.push_back(closest);
+				// in order to determine the desired color, then find the closest match to it in the palette
+				int r = std::min(255, (int)(pal->getColors(currentColor)->r) + (tint->r * opacity));
+				int g = std::min(255, (int)(pal->getColors(currentColor)->g) + (tint->g * opacity));
+				int b = std::min(255, (int)(pal->getColors(currentColor)->b) + (tint->b * opacity));
+				lookUpTable.push_back(matcher.findNearest(r, g, b));
 			}
 		}
 	}
@@ -20,6 +20,7 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <exception>
 #include <SDL.h>
 #include <yaml-cpp/yaml.h>
 #include "../Engine/Options.h"
@@ -263,8 +264,18 @@ private:
 	/// Loads a ruleset from a YAML file that have basic resources configuration.
 	void loadResourceConfigFile(const FileMap::FileRecord &filerec);
 	void loadConstants(const YAML::Node &node);
-	/// Loads a ruleset from a YAML file.
-	void loadFile(const FileMap::FileRecord &filerec, ModScript &parsers);
+	/// Ruleset file parsed ahead of loading.
+	struct ParsedRuleset
+	{
+		YAML::Node doc;
+		std::exception_ptr error;
+		/// Rebuilt from the ruleset cache, which has no line numbers.
+		bool cached = false;
+	};
+	/// Parses the ruleset files of all mods.
+	static std::vector<std::vector<ParsedRuleset>> parseRulesets(const FileMap::RSOrder &mods);
+	/// Loads a ruleset from a YAML document.
+	void loadFile(YAML::Node doc, ModScript &parsers);
 	/// Loads a ruleset element.
 	template <typename T>
 	T *loadRule(const YAML::Node &node, std::map<std::string, T*> *map, std::vector<std::string> *index = 0, const std::string &key = "type") const;
@@ -282,7 +293,7 @@ private:
 	/// Creates a transparency lookup table for a given palette.
 	void createTransparencyLUT(Palette *pal);
 	/// Loads a specified mod content.
-	void loadMod(const std::vector<FileMap::FileRecord> &rulesetFiles, ModScript &parsers);
+	void loadMod(const std::vector<FileMap::FileRecord> &rulesetFiles, const std::vector<ParsedRuleset> &parsedFiles, ModScript &parsers);
 	/// Loads resources from vanilla.
 	void loadVanillaResources();
 	/// Loads resources from extra rulesets.
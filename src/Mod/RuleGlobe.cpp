@@ -26,10 +26,62 @@
 #include "../Geoscape/Globe.h"
 #include "../Engine/FileMap.h"
 #include "../fmath.h"
+#include <algorithm>
 
 namespace OpenXcom
 {
 
+namespace
+{
+
+/**
+ * Widens a latitude range to cover the great circle arc between two points.
+ * Polygon edges are great circle arcs, which bulge toward the pole
+ * past the latitudes of their end points.
+ * @param lon1 Longitude of the first point.
+ * @param lat1 Latitude of the first point.
+ * @param lon2 Longitude of the second point.
+ * @param lat2 Latitude of the second point.
+ * @param latMin Southern bound to widen.
+ * @param latMax Northern bound to widen.
+ */
+void addArcLatitudes(double lon1, double lat1, double lon2, double lat2, double &latMin, double &latMax)
+{
+	double ax = cos(lat1) * cos(lon1), ay = cos(lat1) * sin(lon1), az = sin(lat1);
+	double bx = cos(lat2) * cos(lon2), by = cos(lat2) * sin(lon2), bz = sin(lat2);
+	// normal of the great circle plane
+	double nx = ay * bz - az * by, ny = az * bx - ax * bz, nz = ax * by - ay * bx;
+	double len = sqrt(nx * nx + ny * ny + nz * nz);
+	if (len < 1e-12)
+	{
+		return;
+	}
+	nx /= len; ny /= len; nz /= len;
+	// northernmost point of the circle: the north pole projected onto its plane
+	double px = -nz * nx, py = -nz * ny, pz = 1 - nz * nz;
+	double plen = sqrt(px * px + py * py + pz * pz);
+	if (plen < 1e-12)
+	{
+		return;
+	}
+	px /= plen; py /= plen; pz /= plen;
+	double extreme = asin(std::min(1.0, pz));
+	// the point lies on the arc if it's after a and before b going around the normal
+	double after = (ay * pz - az * py) * nx + (az * px - ax * pz) * ny + (ax * py - ay * px) * nz;
+	double before = (py * bz - pz * by) * nx + (pz * bx - px * bz) * ny + (px * by - py * bx) * nz;
+	if (after >= 0 && before >= 0)
+	{
+		latMax = std::max(latMax, extreme);
+	}
+	// and the southernmost point is opposite it
+	if (after <= 0 && before <= 0)
+	{
+		latMin = std::min(latMin, -extreme);
+	}
+}
+
+}
+
 /**
  * Creates a blank ruleset for globe contents.
  */
@@ -139,6 +191,132 @@ void RuleGlobe::load(const YAML::Node &node)
 	Globe::OCEAN_SHADING = node["oceanShading"].as<bool>(Globe::OCEAN_SHADING);
 }
 
+/**
+ * Sorts all the world polygons into a lookup grid
+ * by their bounds, so point queries like land checks
+ * only test the polygons around the point, and
+ * precomputes the vertices used for drawing them.
+ */
+void RuleGlobe::afterLoad()
+{
+	// small pad for rounding in the point in polygon test
+	const double margin = Deg2Rad(2.0);
+
+	_polygonGrid.clear();
+	for (std::list<Polygon*>::iterator i = _polygons.begin(); i != _polygons.end(); ++i)
+	{
+		Polygon *poly = *i;
+		std::vector<double> lons;
+		double latMin = M_PI_2, latMax = -M_PI_2;
+		for (int j = 0; j < poly->getPoints(); ++j)
+		{
+			double lon = fmod(poly->getLongitude(j), 2 * M_PI);
+			if (lon < 0)
+				lon += 2 * M_PI;
+			lons.push_back(lon);
+			latMin = std::min(latMin, poly->getLatitude(j));
+			latMax = std::max(latMax, poly->getLatitude(j));
+		}
+		if (lons.empty())
+		{
+			continue;
+		}
+		// the edges are great circle arcs, which can reach past the points
+		for (int j = 0; j < poly->getPoints(); ++j)
+		{
+			int k = (j + 1) % poly->getPoints();
+			addArcLatitudes(poly->getLongitude(j), poly->getLatitude(j), poly->getLongitude(k), poly->getLatitude(k), latMin, latMax);
+		}
+
+		// the bounds are the complement of the biggest gap between points
+		std::sort(lons.begin(), lons.end());
+		double gap = lons.front() + 2 * M_PI - lons.back();
+		double lonMin = lons.front(), lonMax = lons.back();
+		for (size_t j = 1; j < lons.size(); ++j)
+		{
+			if (lons[j] - lons[j - 1] > gap)
+			{
+				gap = lons[j] - lons[j - 1];
+				lonMin = lons[j];
+				lonMax = lons[j - 1];
+			}
+		}
+
+		// polygons spanning half the globe surround a pole
+		bool allLon = gap < M_PI;
+		if (allLon)
+		{
+			if (latMin + latMax > 0)
+				latMax = M_PI_2;
+			else
+				latMin = -M_PI_2;
+		}
+		double lonMargin = margin / std::max(cos(std::max(fabs(latMin), fabs(latMax))), 0.05);
+		if (latMax + margin >= M_PI_2 || latMin - margin <= -M_PI_2 || lonMargin >= M_PI_2)
+		{
+			allLon = true;
+		}
+		_polygonGrid.insert(poly, lonMin - lonMargin, lonMax + lonMargin, latMin - margin, latMax + margin, allLon);
+	}
+
+	buildVertices();
+}
+
+/**
+ * Converts every world polygon vertex into a unit vector
+ * and finds the smallest cap around each polygon's points,
+ * so the globe doesn't need any trigonometry per vertex.
+ */
+void RuleGlobe::buildVertices()
+{
+	_vertices = GlobeVertices();
+	for (std::list<Polygon*>::iterator i = _polygons.begin(); i != _polygons.end(); ++i)
+	{
+		Polygon *poly = *i;
+		size_t first = _vertices.x.size();
+		double cx = 0.0, cy = 0.0, cz = 0.0;
+		for (int j = 0; j < poly->getPoints(); ++j)
+		{
+			double lon = poly->getLongitude(j), lat = poly->getLatitude(j);
+			double x = cos(lat) * cos(lon), y = cos(lat) * sin(lon), z = sin(lat);
+			_vertices.x.push_back(x);
+			_vertices.y.push_back(y);
+			_vertices.z.push_back(z);
+			cx += x;
+			cy += y;
+			cz += z;
+		}
+
+		// a cap wider than a hemisphere can't prove anything, so never cull with it
+		double limit = -2.0;
+		double len = sqrt(cx * cx + cy * cy + cz * cz);
+		if (len > 1e-6)
+		{
+			cx /= len;
+			cy /= len;
+			cz /= len;
+			double minCos = 1.0;
+			for (size_t j = first; j < _vertices.x.size(); ++j)
+			{
+				minCos = std::min(minCos, cx * _vertices.x[j] + cy * _vertices.y[j] + cz * _vertices.z[j]);
+			}
+			if (minCos > 0.0)
+			{
+				// cos(90 + radius), with a little slack for rounding
+				limit = -sqrt(1.0 - minCos * minCos) - 1e-9;
+			}
+		}
+
+		_vertices.polygons.push_back(poly);
+		_vertices.first.push_back(first);
+		_vertices.capX.push_back(cx);
+		_vertices.capY.push_back(cy);
+		_vertices.capZ.push_back(cz);
+		_vertices.capLimit.push_back(limit);
+	}
+	_vertices.first.push_back(_vertices.x.size());
+}
+
 /**
  * Returns the list of polygons in the globe.
  * @return Pointer to the list of polygons.
@@ -19,7 +19,9 @@
  */
 #include <list>
 #include <string>
+#include <vector>
 #include <yaml-cpp/yaml.h>
+#include "../Engine/LonLatGrid.h"
 
 namespace OpenXcom
 {
@@ -28,6 +30,25 @@ class Polygon;
 class Polyline;
 class Texture;
 
+/**
+ * World polygon vertices precomputed as unit vectors,
+ * laid out as structure-of-arrays so the globe can
+ * project them with a single rotation per frame.
+ */
+struct GlobeVertices
+{
+	/// Polygons in the same order as the ruleset list.
+	std::vector<Polygon*> polygons;
+	/// Index of the first vertex of each polygon, plus one past the end.
+	std::vector<size_t> first;
+	/// Vertex unit vectors, polygon after polygon.
+	std::vector<double> x, y, z;
+	/// Centre of the cap bounding each polygon.
+	std::vector<double> capX, capY, capZ;
+	/// Polygon is all behind the view when the view direction dotted with the centre is below this.
+	std::vector<double> capLimit;
+};
+
 /**
  * Represents the contents of the Geoscape globe,
  * such as world polygons, polylines, etc.
@@ -39,6 +60,11 @@ private:
 	std::list<Polygon*> _polygons;
 	std::list<Polyline*> _polylines;
 	std::map<int, Texture*> _textures;
+	LonLatGrid<Polygon> _polygonGrid;
+	GlobeVertices _vertices;
+
+	/// Precomputes the polygon vertex tables.
+	void buildVertices();
 public:
 	/// Creates a blank globe ruleset.
 	RuleGlobe();
@@ -46,8 +72,14 @@ public:
 	~RuleGlobe();
 	/// Loads the globe from YAML.
 	void load(const YAML::Node& node);
+	/// Builds the polygon lookup grid and vertex tables.
+	void afterLoad();
 	/// Gets the list of world polygons.
 	std::list<Polygon*> *getPolygons();
+	/// Gets the world polygons that can contain a point.
+	const std::vector<Polygon*> &getPolygonsNear(double lon, double lat) const { return _polygonGrid.get(lon, lat); }
+	/// Gets the precomputed world polygon vertices.
+	const GlobeVertices &getVertices() const { return _vertices; }
 	/// Gets the list of world polylines.
 	std::list<Polyline*> *getPolylines();
 	/// Loads a set of polygons from a DAT file.
@@ -57,6 +57,7 @@ namespace OpenXcom
 Base::Base(const Mod *mod) : Target(), _mod(mod), _scientists(0), _engineers(0), _inBattlescape(false), _retaliationTarget(false), _fakeUnderwater(false)
 {
 	_items = new ItemContainer();
+	_craftsByStatus.resize(CRAFT_STATUS_MAX);
 }
 
 /**
@@ -128,7 +129,7 @@ void Base::load(const YAML::Node &node, SavedGame *save, bool newGame, bool newB
 		{
 			Craft *c = new Craft(_mod->getCraft(type), this);
 			c->load(*i, _mod, save);
-			_crafts.push_back(c);
+			addCraft(c);
 		}
 		else
 		{
@@ -428,6 +429,58 @@ std::vector<Craft*> *Base::getCrafts()
 	return &_crafts;
 }
 
+/**
+ * Returns the list of crafts in the base with a certain status,
+ * in the same order as the main craft list.
+ * @param status Craft status.
+ * @return Reference to the craft list.
+ */
+const std::vector<Craft*> &Base::getCraftsByStatus(CraftStatus status) const
+{
+	return _craftsByStatus[status];
+}
+
+/**
+ * Adds a craft to the base, registering it
+ * in the list for its current status.
+ * @param craft Pointer to craft.
+ */
+void Base::addCraft(Craft *craft)
+{
+	_crafts.push_back(craft);
+	_craftsByStatus[craft->getStatus()].push_back(craft);
+}
+
+/**
+ * Moves a craft of this base from its old status list
+ * to the one matching its current status.
+ * Crafts not registered in the base are ignored.
+ * @param craft Pointer to craft.
+ * @param oldStatus Previous craft status.
+ */
+void Base::updateCraftStatus(Craft *craft, CraftStatus oldStatus)
+{
+	std::vector<Craft*> &oldList = _craftsByStatus[oldStatus];
+	std::vector<Craft*>::iterator i = std::find(oldList.begin(), oldList.end(), craft);
+	if (i == oldList.end())
+	{
+		return;
+	}
+	oldList.erase(i);
+
+	// keep the same relative order as the main craft list
+	std::vector<Craft*> &newList = _craftsByStatus[craft->getStatus()];
+	std::vector<Craft*>::iterator pos = newList.begin();
+	for (std::vector<Craft*>::const_iterator c = _crafts.begin(); c != _crafts.end() && *c != craft; ++c)
+	{
+		if (pos != newList.end() && *pos == *c)
+		{
+			++pos;
+		}
+	}
+	newList.insert(pos, craft);
+}
+
 /**
  * Returns the list of transfers destined
  * to this base.
@@ -586,7 +639,7 @@ int Base::getAvailableSoldiers(bool checkCombatReadiness, bool includeWounded) c
 		{
 			total++;
 		}
-		else if (checkCombatReadiness && (((*i)->getCraft() != 0 && (*i)->getCraft()->getStatus() != "STR_OUT") ||
+		else if (checkCombatReadiness && (((*i)->getCraft() != 0 && (*i)->getCraft()->getStatus() != CRAFT_OUT) ||
 			((*i)->getCraft() == 0 && ((*i)->hasFullHealth() || (includeWounded && (*i)->canDefendBase())))))
 		{
 			total++;
@@ -882,7 +935,7 @@ double Base::getIgnoredStores()
 	double space = 0;
 	for (std::vector<Craft*>::iterator c = getCrafts()->begin(); c != getCrafts()->end(); ++c)
 	{
-		if ((*c)->getStatus() == "STR_REARMING")
+		if ((*c)->getStatus() == CRAFT_REARMING)
 		{
 			for (std::vector<CraftWeapon*>::iterator w = (*c)->getWeapons()->begin(); w != (*c)->getWeapons()->end() ; ++w)
 			{
@@ -1146,6 +1199,24 @@ int Base::getLongRangeDetection() const
 	return total;
 }
 
+/**
+ * Returns the range of the farthest reaching
+ * finished facility in the base, be it radar or hyperwave.
+ * @return Range in nautical miles.
+ */
+int Base::getMaxRadarRange() const
+{
+	int range = 0;
+	for (std::vector<BaseFacility*>::const_iterator i = _facilities.begin(); i != _facilities.end(); ++i)
+	{
+		if ((*i)->getBuildTime() == 0)
+		{
+			range = std::max(range, (*i)->getRules()->getRadarRange());
+		}
+	}
+	return range;
+}
+
 /**
  * Returns the total amount of craft of
  * a certain type stored in the base.
@@ -1180,7 +1251,7 @@ int Base::getCraftCountForProduction(const RuleCraft *craft) const
 	int total = 0;
 	for (std::vector<Craft*>::const_iterator i = _crafts.begin(); i != _crafts.end(); ++i)
 	{
-		if ((*i)->getRules() == craft && (*i)->getStatus() != "STR_OUT")
+		if ((*i)->getRules() == craft && (*i)->getStatus() != CRAFT_OUT)
 		{
 			total++;
 		}
@@ -1631,7 +1702,7 @@ void Base::setupDefenses()
 	// add vehicles that are in the crafts of the base, if it's not out
 	for (std::vector<Craft*>::iterator c = getCrafts()->begin(); c != getCrafts()->end(); ++c)
 	{
-		if ((*c)->getStatus() != "STR_OUT")
+		if ((*c)->getStatus() != CRAFT_OUT)
 		{
 			for (std::vector<Vehicle*>::iterator i = (*c)->getVehicles()->begin(); i != (*c)->getVehicles()->end(); ++i)
 			{
@@ -2337,6 +2408,8 @@ std::vector<Craft*>::iterator Base::removeCraft(Craft *craft, bool unload)
 	}
 
 	// Remove craft
+	std::vector<Craft*> &statusList = _craftsByStatus[craft->getStatus()];
+	statusList.erase(std::remove(statusList.begin(), statusList.end(), craft), statusList.end());
 	std::vector<Craft*>::iterator c;
 	for (c = _crafts.begin(); c != _crafts.end(); ++c)
 	{
@@ -41,6 +41,7 @@ class Vehicle;
 class Ufo;
 
 enum UfoDetection : int;
+enum CraftStatus : int;
 
 /**
  * Represents a player base on the globe.
@@ -54,6 +55,7 @@ private:
 	std::vector<BaseFacility*> _facilities;
 	std::vector<Soldier*> _soldiers;
 	std::vector<Craft*> _crafts;
+	std::vector<std::vector<Craft*> > _craftsByStatus;
 	std::vector<Transfer*> _transfers;
 	ItemContainer *_items;
 	int _scientists, _engineers;
@@ -97,6 +99,12 @@ public:
 	void prepareSoldierStatsWithBonuses();
 	/// Gets the base's crafts.
 	std::vector<Craft*> *getCrafts();
+	/// Gets the base's crafts with a certain status.
+	const std::vector<Craft*> &getCraftsByStatus(CraftStatus status) const;
+	/// Adds a craft to the base.
+	void addCraft(Craft *craft);
+	/// Moves a craft to the list matching its new status.
+	void updateCraftStatus(Craft *craft, CraftStatus oldStatus);
 	/// Gets the base's transfers.
 	std::vector<Transfer*> *getTransfers();
 	/// Gets the base's items.
@@ -161,6 +169,8 @@ public:
 	int getShortRangeDetection() const;
 	/// Gets the base's long range detection.
 	int getLongRangeDetection() const;
+	/// Gets the base's maximum radar range.
+	int getMaxRadarRange() const;
 	/// Gets the base's crafts of a certain type.
 	int getCraftCount(const RuleCraft *craft) const;
 	/// Gets the base's crafts of a certain type.
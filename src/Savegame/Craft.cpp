@@ -57,7 +57,7 @@ namespace OpenXcom
 Craft::Craft(const RuleCraft *rules, Base *base, int id) : MovingTarget(),
 	_rules(rules), _base(base), _fuel(0), _damage(0), _shield(0),
 	_interceptionOrder(0), _takeoff(0), _weapons(),
-	_status("STR_READY"), _lowFuel(false), _mission(false),
+	_status(CRAFT_READY), _lowFuel(false), _mission(false),
 	_inBattlescape(false), _inDogfight(false), _stats(),
 	_isAutoPatrolling(false), _lonAuto(0.0), _latAuto(0.0)
 {
@@ -179,7 +179,10 @@ void Craft::load(const YAML::Node &node, const Mod *mod, SavedGame *save)
 			Log(LOG_ERROR) << "Failed to load vehicles item " << type;
 		}
 	}
-	_status = node["status"].as<std::string>(_status);
+	if (const YAML::Node &status = node["status"])
+	{
+		_status = getStatusFromString(status.as<std::string>());
+	}
 	_lowFuel = node["lowFuel"].as<bool>(_lowFuel);
 	_mission = node["mission"].as<bool>(_mission);
 	_interceptionOrder = node["interceptionOrder"].as<int>(_interceptionOrder);
@@ -305,7 +308,7 @@ YAML::Node Craft::save() const
 	{
 		node["vehicles"].push_back((*i)->save());
 	}
-	node["status"] = _status;
+	node["status"] = getStatusString(_status);
 	if (_lowFuel)
 		node["lowFuel"] = _lowFuel;
 	if (_mission)
@@ -388,7 +391,7 @@ std::string Craft::getDefaultName(Language *lang) const
  */
 int Craft::getMarker() const
 {
-	if (_status != "STR_OUT")
+	if (_status != CRAFT_OUT)
 		return -1;
 	else if (_rules->getMarker() == -1)
 		return 1;
@@ -420,21 +423,51 @@ void Craft::setBase(Base *base, bool move)
 }
 
 /**
- * Returns the current status of the craft.
- * @return Status string.
+ * Changes the current status of the craft,
+ * keeping the base's per-status craft lists up to date.
+ * @param status New status.
  */
-std::string Craft::getStatus() const
+void Craft::setStatus(CraftStatus status)
 {
-	return _status;
+	if (status == _status)
+		return;
+	CraftStatus old = _status;
+	_status = status;
+	if (_base != 0)
+	{
+		_base->updateCraftStatus(this, old);
+	}
 }
 
 /**
- * Changes the current status of the craft.
- * @param status Status string.
+ * Returns the string ID used for a craft status
+ * in the UI and in save files.
+ * @param status Craft status.
+ * @return Status string ID.
  */
-void Craft::setStatus(const std::string &status)
+const std::string &Craft::getStatusString(CraftStatus status)
 {
-	_status = status;
+	static const std::string names[CRAFT_STATUS_MAX] = { "STR_READY", "STR_OUT", "STR_REPAIRS", "STR_REFUELLING", "STR_REARMING" };
+	return names[status];
+}
+
+/**
+ * Returns the craft status matching a string ID,
+ * as stored in save files.
+ * @param status Status string ID.
+ * @return Craft status (ready if unknown).
+ */
+CraftStatus Craft::getStatusFromString(const std::string &status)
+{
+	for (int i = 0; i < CRAFT_STATUS_MAX; ++i)
+	{
+		if (status == getStatusString((CraftStatus)i))
+		{
+			return (CraftStatus)i;
+		}
+	}
+	Log(LOG_WARNING) << "Unknown craft status " << status;
+	return CRAFT_READY;
 }
 
 /**
@@ -461,7 +494,7 @@ std::string Craft::getAltitude() const
  */
 void Craft::setDestination(Target *dest)
 {
-	if (_status != "STR_OUT")
+	if (_status != CRAFT_OUT)
 	{
 		_takeoff = 60;
 	}
@@ -962,19 +995,19 @@ void Craft::checkup()
 
 	if (_damage > 0)
 	{
-		_status = "STR_REPAIRS";
+		setStatus(CRAFT_REPAIRS);
 	}
 	else if (available != full)
 	{
-		_status = "STR_REARMING";
+		setStatus(CRAFT_REARMING);
 	}
 	else if (_fuel < _stats.fuelMax)
 	{
-		_status = "STR_REFUELLING";
+		setStatus(CRAFT_REFUELLING);
 	}
 	else
 	{
-		_status = "STR_READY";
+		setStatus(CRAFT_READY);
 	}
 }
 
@@ -1094,7 +1127,7 @@ void Craft::repair()
 	setDamage(_damage - _rules->getRepairRate());
 	if (_damage <= 0)
 	{
-		_status = "STR_REARMING";
+		setStatus(CRAFT_REARMING);
 	}
 }
 
@@ -1107,12 +1140,12 @@ void Craft::refuel()
 	setFuel(_fuel + _rules->getRefuelRate());
 	if (_fuel >= _stats.fuelMax)
 	{
-		_status = "STR_READY";
+		setStatus(CRAFT_READY);
 		for (std::vector<CraftWeapon*>::iterator i = _weapons.begin(); i != _weapons.end(); ++i)
 		{
 			if (*i && (*i)->isRearming())
 			{
-				_status = "STR_REARMING";
+				setStatus(CRAFT_REARMING);
 				break;
 			}
 		}
@@ -1132,7 +1165,7 @@ std::string Craft::rearm(const Mod *mod)
 	{
 		if (i == _weapons.end())
 		{
-			_status = "STR_REFUELLING";
+			setStatus(CRAFT_REFUELLING);
 			break;
 		}
 		if (*i != 0 && (*i)->isRearming())
@@ -1592,7 +1625,7 @@ void Craft::reuseItem(const std::string& item)
 	// (And we don't want to interrupt any out-of-base status.)
 
 	// The only states we are willing to interrupt are "ready" and "refuelling"
-	if (_status != "STR_READY" && _status != "STR_REFUELLING")
+	if (_status != CRAFT_READY && _status != CRAFT_REFUELLING)
 	{
 		return;
 	}
@@ -1603,17 +1636,17 @@ void Craft::reuseItem(const std::string& item)
 		if ((*w) != 0 && item == (*w)->getRules()->getClipItem() && (*w)->getAmmo() < (*w)->getRules()->getAmmoMax() && !(*w)->isDisabled())
 		{
 			(*w)->setRearming(true);
-			_status = "STR_REARMING";
+			setStatus(CRAFT_REARMING);
 		}
 	}
 
 	// Only consider refuelling if everything else is complete
-	if (_status != "STR_READY")
+	if (_status != CRAFT_READY)
 		return;
 
 	// Check if it's fuel to refuel the craft
 	if (item == _rules->getRefuelItem() && _fuel < _stats.fuelMax)
-		_status = "STR_REFUELLING";
+		setStatus(CRAFT_REFUELLING);
 }
 
 /**
@@ -40,6 +40,16 @@ class RuleStartingCondition;
 
 enum UfoDetection : int;
 
+enum CraftStatus : int
+{
+	CRAFT_READY,
+	CRAFT_OUT,
+	CRAFT_REPAIRS,
+	CRAFT_REFUELLING,
+	CRAFT_REARMING,
+	CRAFT_STATUS_MAX,
+};
+
 /**
  * Represents a craft stored in a base.
  * Contains variable info about a craft like
@@ -55,7 +65,7 @@ private:
 	std::vector<CraftWeapon*> _weapons;
 	ItemContainer *_items;
 	std::vector<Vehicle*> _vehicles;
-	std::string _status;
+	CraftStatus _status;
 	bool _lowFuel, _mission, _inBattlescape, _inDogfight;
 	double _speedMaxRadian;
 	RuleCraftStats _stats;
@@ -94,9 +104,15 @@ public:
 	/// Sets the craft's base.
 	void setBase(Base *base, bool move = true);
 	/// Gets the craft's status.
-	std::string getStatus() const;
+	CraftStatus getStatus() const { return _status; }
+	/// Gets the craft's status string ID.
+	const std::string &getStatusString() const { return getStatusString(_status); }
 	/// Sets the craft's status.
-	void setStatus(const std::string &status);
+	void setStatus(CraftStatus status);
+	/// Gets the string ID of a craft status.
+	static const std::string &getStatusString(CraftStatus status);
+	/// Gets the craft status matching a string ID.
+	static CraftStatus getStatusFromString(const std::string &status);
 	/// Gets the craft's altitude.
 	std::string getAltitude() const;
 	/// Sets the craft's destination.
@@ -915,7 +915,7 @@ void SaveConverter::loadDatCraft()
 				{
 					Base *b = dynamic_cast<Base*>(_targets[base]);
 					craft->setBase(b, false);
-					b->getCrafts()->push_back(craft);
+					b->addCraft(craft);
 				}
 			}
 			Ufo *ufo = dynamic_cast<Ufo*>(_targets[i]);
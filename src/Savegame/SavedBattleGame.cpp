@@ -41,6 +41,7 @@
 #include "../Engine/RNG.h"
 #include "../Engine/Options.h"
 #include "../Engine/Logger.h"
+#include "../Engine/Exception.h"
 #include "../Engine/ScriptBind.h"
 #include "SerializationHelper.h"
 #include "../Mod/RuleEnviroEffects.h"
@@ -187,9 +188,27 @@ void SavedBattleGame::load(const YAML::Node &node, Mod *mod, SavedGame* savedGam
 		serKey.boolFields = node["tileBoolFieldsSize"].as<Uint8>(1); // boolean flags used to be stored in an unmentioned byte (Uint8) :|
 
 		// load binary tile data!
-		YAML::Binary binTiles = node["binTiles"].as<YAML::Binary>();
+		std::vector<Uint8> tileData;
+		if (node["binTilesPacked"])
+		{
+			if (node["tilePackVersion"].as<int>(0) != TILE_PACK_VERSION)
+			{
+				throw Exception("Unsupported battle tile data version");
+			}
+			YAML::Binary binTiles = node["binTilesPacked"].as<YAML::Binary>();
+			tileData.resize(totalTiles * serKey.totalBytes);
+			if (!unpackRecords(binTiles.data(), binTiles.size(), tileData.data(), totalTiles, serKey.totalBytes))
+			{
+				throw Exception("Battle tile data is corrupted");
+			}
+		}
+		else
+		{
+			YAML::Binary binTiles = node["binTiles"].as<YAML::Binary>();
+			tileData.assign(binTiles.data(), binTiles.data() + binTiles.size());
+		}
 
-		Uint8 *r = (Uint8*)binTiles.data();
+		Uint8 *r = tileData.data();
 		Uint8 *dataEnd = r + totalTiles * serKey.totalBytes;
 
 		while (r < dataEnd)
@@ -502,8 +521,11 @@ YAML::Node SavedBattleGame::save() const
 			tileDataSize -= Tile::serializationKey.totalBytes;
 		}
 	}
-	node["totalTiles"] = tileDataSize / Tile::serializationKey.totalBytes; // not strictly necessary, just convenient
-	node["binTiles"] = YAML::Binary(tileData, tileDataSize);
+	size_t totalTiles = tileDataSize / Tile::serializationKey.totalBytes;
+	node["totalTiles"] = totalTiles;
+	std::vector<Uint8> packed = packRecords(tileData, totalTiles, Tile::serializationKey.totalBytes);
+	node["tilePackVersion"] = TILE_PACK_VERSION;
+	node["binTilesPacked"] = YAML::Binary(packed.data(), packed.size());
 	free(tileData);
 #endif
 	for (std::vector<Node*>::const_iterator i = _nodes.begin(); i != _nodes.end(); ++i)
@@ -55,6 +55,8 @@ public:
 	static constexpr const char *ScriptName = "BattleGame";
 	/// Register all useful function used by script.
 	static void ScriptRegister(ScriptParserBase* parser);
+	/// Version of the packed tile data written to saves.
+	static const int TILE_PACK_VERSION = 1;
 
 private:
 	BattlescapeState *_battleState;
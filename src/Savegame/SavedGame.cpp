@@ -22,6 +22,9 @@
 #include <iomanip>
 #include <algorithm>
 #include <ctime>
+#include <future>
+#include <unordered_map>
+#include <SDL.h>
 #include <yaml-cpp/yaml.h>
 #include "../version.h"
 #include "../Engine/Logger.h"
@@ -32,6 +35,9 @@
 #include "../Engine/Options.h"
 #include "../Engine/CrossPlatform.h"
 #include "../Engine/ScriptBind.h"
+#include "../Engine/YamlBinary.h"
+#include "../Engine/Parallel.h"
+#include "../Engine/RulesetCache.h"
 #include "SavedBattleGame.h"
 #include "SerializationHelper.h"
 #include "GameTime.h"
@@ -75,6 +81,278 @@ const std::string SavedGame::AUTOSAVE_GEOSCAPE = "_autogeo_.asav",
 namespace
 {
 
+/// Identifies a binary save file.
+const char BinarySaveMagic[4] = { 'O', 'X', 'S', 'B' };
+/// Bump whenever the binary save layout changes.
+const Uint64 BinarySaveVersion = 1;
+/// Enough bytes to hold the magic, version and brief info size.
+const size_t BinarySavePrefix = sizeof(BinarySaveMagic) + 20;
+
+/**
+ * Reads the start of a file as raw bytes.
+ * @param filepath Full path of the file.
+ * @param limit Maximum number of bytes to read.
+ * @return File bytes, can be shorter than the limit.
+ */
+std::string readFileBytes(const std::string &filepath, size_t limit)
+{
+	SDL_RWops *rwops = SDL_RWFromFile(filepath.c_str(), "rb");
+	if (!rwops)
+	{
+		throw Exception("Failed to read " + filepath + ": " + SDL_GetError());
+	}
+	std::string data;
+	char buffer[65536];
+	while (data.size() < limit)
+	{
+		size_t read = SDL_RWread(rwops, buffer, 1, std::min(sizeof(buffer), limit - data.size()));
+		if (read == 0 || read == (size_t)-1)
+		{
+			break;
+		}
+		data.append(buffer, read);
+	}
+	SDL_RWclose(rwops);
+	return data;
+}
+
+/**
+ * Checks the signature of a binary save.
+ * @param data Start of the file.
+ * @return True if it's a binary save, false if it's a YAML one.
+ */
+bool isBinarySave(const std::string &data)
+{
+	return data.size() >= sizeof(BinarySaveMagic) && std::equal(BinarySaveMagic, BinarySaveMagic + sizeof(BinarySaveMagic), data.begin());
+}
+
+/**
+ * Skips past the signature and version of a binary save.
+ * @param in Reader at the start of the file.
+ * @throw Exception if the save has an unknown version.
+ */
+void readBinarySaveVersion(YamlBinary::Reader &in)
+{
+	in.need(sizeof(BinarySaveMagic));
+	in.pos += sizeof(BinarySaveMagic);
+	if (in.number() != BinarySaveVersion)
+	{
+		throw Exception("Unsupported binary save version");
+	}
+}
+
+/**
+ * Reads the brief info of a binary save, without going through the rest.
+ * @param filepath Full path of the save.
+ * @param brief Gets the brief info.
+ * @return False if the save is a YAML one.
+ */
+bool loadBinarySaveBrief(const std::string &filepath, YAML::Node &brief)
+{
+	std::string data = readFileBytes(filepath, BinarySavePrefix);
+	if (!isBinarySave(data))
+	{
+		return false;
+	}
+	YamlBinary::Reader in = { data.data(), data.data() + data.size() };
+	readBinarySaveVersion(in);
+	size_t size = in.number();
+	size_t start = in.pos - data.data();
+	if (data.size() < start + size)
+	{
+		data = readFileBytes(filepath, start + size);
+	}
+	in = { data.data() + start, data.data() + data.size() };
+	in.need(size);
+	brief = in.node();
+	return true;
+}
+
+/**
+ * Reads both documents of a binary save.
+ * @param filepath Full path of the save.
+ * @param file Gets the brief info and the full game data.
+ * @return False if the save is a YAML one.
+ */
+bool loadBinarySave(const std::string &filepath, std::vector<YAML::Node> &file)
+{
+	if (!isBinarySave(readFileBytes(filepath, sizeof(BinarySaveMagic))))
+	{
+		return false;
+	}
+	std::string data = readFileBytes(filepath, (size_t)-1);
+	YamlBinary::Reader in = { data.data(), data.data() + data.size() };
+	readBinarySaveVersion(in);
+	in.number();
+	file.push_back(in.node());
+	file.push_back(in.node());
+	return true;
+}
+
+/**
+ * Reads the brief info of a save, whichever format it is.
+ * @param filepath Full path of the save.
+ * @return Brief info used in the saves list.
+ */
+YAML::Node loadSaveBrief(const std::string &filepath)
+{
+	YAML::Node brief;
+	if (!loadBinarySaveBrief(filepath, brief))
+	{
+		brief = YAML::Load(*CrossPlatform::getYamlSaveHeader(filepath));
+	}
+	return brief;
+}
+
+/// Identifies the save index file.
+const char SaveIndexMagic[4] = { 'O', 'X', 'S', 'I' };
+/// Bump whenever the save index layout changes.
+const Uint64 SaveIndexVersion = 2;
+/// Bytes at the start of a save hashed to notice rewrites, they hold the brief info.
+const size_t SaveHeadBytes = 4096;
+/// Name of the save index file in the master user folder.
+const std::string SaveIndexFile = "saves.index";
+
+/**
+ * Brief info of a save, along with what identifies
+ * the version of the file it was read from.
+ */
+struct SaveIndexEntry
+{
+	Uint64 size = 0;
+	time_t timestamp = 0;
+	Uint64 head = 0;
+	YAML::Node brief;
+};
+/// Save index entries by filename.
+typedef std::unordered_map<std::string, SaveIndexEntry> SaveIndex;
+
+/// Folder the save index was read from.
+std::string saveIndexFolder;
+/// Save index of that folder.
+SaveIndex saveIndex;
+
+/**
+ * Hashes the start of a save. Timestamps only have a one second
+ * resolution, so a quicksave or autosave rewritten with the same size
+ * in the same second is only noticed by its contents.
+ * @param filepath Full path of the save.
+ * @return Hash of the first bytes, or 0 if the file can't be read.
+ */
+Uint64 hashSaveHead(const std::string &filepath)
+{
+	try
+	{
+		return RulesetCache::hash(readFileBytes(filepath, SaveHeadBytes));
+	}
+	catch (Exception &)
+	{
+		return 0;
+	}
+}
+
+/**
+ * Reads the save index of a folder.
+ * A missing, outdated or damaged file just gives an empty index.
+ * @param filepath Full path of the index file.
+ * @return Save index.
+ */
+SaveIndex loadSaveIndex(const std::string &filepath)
+{
+	SaveIndex index;
+	if (!CrossPlatform::fileExists(filepath))
+	{
+		return index;
+	}
+	try
+	{
+		std::string data = readFileBytes(filepath, (size_t)-1);
+		YamlBinary::Reader in = { data.data(), data.data() + data.size() };
+		in.need(sizeof(SaveIndexMagic));
+		if (!std::equal(SaveIndexMagic, SaveIndexMagic + sizeof(SaveIndexMagic), in.pos))
+		{
+			throw Exception("Save index has a wrong signature");
+		}
+		in.pos += sizeof(SaveIndexMagic);
+		if (in.number() != SaveIndexVersion)
+		{
+			throw Exception("Save index has a different version");
+		}
+		for (Uint64 i = in.number(); i > 0; --i)
+		{
+			SaveIndexEntry &entry = index[in.string()];
+			entry.size = in.number();
+			entry.timestamp = (time_t)in.fixed64();
+			entry.head = in.fixed64();
+			entry.brief = in.node();
+		}
+	}
+	catch (Exception &e)
+	{
+		Log(LOG_INFO) << filepath << ": " << e.what() << ", ignoring it.";
+		index.clear();
+	}
+	return index;
+}
+
+/**
+ * Writes the save index of a folder.
+ * @param filepath Full path of the index file.
+ * @param index Save index.
+ */
+void saveSaveIndex(const std::string &filepath, const SaveIndex &index)
+{
+	std::string out(SaveIndexMagic, sizeof(SaveIndexMagic));
+	YamlBinary::writeNumber(out, SaveIndexVersion);
+	YamlBinary::writeNumber(out, index.size());
+	for (SaveIndex::const_iterator i = index.begin(); i != index.end(); ++i)
+	{
+		YamlBinary::writeString(out, i->first);
+		YamlBinary::writeNumber(out, i->second.size);
+		YamlBinary::writeFixed64(out, (Uint64)i->second.timestamp);
+		YamlBinary::writeFixed64(out, i->second.head);
+		YamlBinary::writeNode(out, i->second.brief);
+	}
+	CrossPlatform::writeFile(filepath, std::vector<unsigned char>(out.begin(), out.end()));
+}
+
+/**
+ * Writes the collected contents of a saved game to a file.
+ * Doesn't touch the game itself, so it can run on any thread.
+ * @param filepath Full path of the save.
+ * @param brief Brief info used in the saves list.
+ * @param node Full game data.
+ * @param binary Use the binary format instead of YAML.
+ */
+void writeSave(const std::string &filepath, const YAML::Node &brief, const YAML::Node &node, bool binary)
+{
+	bool written;
+	if (binary)
+	{
+		// the brief info goes first with its size, so the saves list can skip the rest
+		std::string out(BinarySaveMagic, sizeof(BinarySaveMagic));
+		YamlBinary::writeNumber(out, BinarySaveVersion);
+		YamlBinary::writeString(out, YamlBinary::encode(brief));
+		YamlBinary::writeNode(out, node);
+		written = CrossPlatform::writeFile(filepath, std::vector<unsigned char>(out.begin(), out.end()));
+	}
+	else
+	{
+		YAML::Emitter out;
+		out << brief;
+		out << YAML::BeginDoc;
+		out << node;
+		written = CrossPlatform::writeFile(filepath, out.c_str());
+	}
+	if (!written)
+	{
+		throw Exception("Failed to save " + filepath);
+	}
+}
+
+/// Save being written by saveInBackground, if any.
+std::future<void> backgroundSave;
+
 struct findRuleResearch
 {
 	typedef ResearchProject* argument_type;
@@ -143,7 +421,8 @@ bool haveReserchVector(const std::vector<const RuleResearch*> &vec,  const std::
  */
 SavedGame::SavedGame() : _difficulty(DIFF_BEGINNER), _end(END_NONE), _ironman(false), _globeLon(0.0),
 						 _globeLat(0.0), _globeZoom(0), _battleGame(0), _debug(false),
-						 _warned(false), _monthsPassed(-1), _selectedBase(0), _autosales(), _disableSoldierEquipment(false), _alienContainmentChecked(false)
+						 _warned(false), _monthsPassed(-1), _selectedBase(0), _autosales(), _disableSoldierEquipment(false), _alienContainmentChecked(false),
+						 _countryGridSize(0), _regionGridSize(0), _missionStatisticsIndexed(0)
 {
 	_time = new GameTime(6, 1, 1, 1999, 12, 0, 0);
 	_alienStrategy = new AlienStrategy();
@@ -276,6 +555,9 @@ static bool _isCurrentGameType(const SaveInfo &saveInfo, const std::string &curM
 
 /**
  * Gets all the info of the saves found in the user folder.
+ * The brief info of every save is kept in an index file, so only
+ * the saves that were added or changed since the last time have
+ * to be opened, and those are read in parallel.
  * @param lang Loaded language.
  * @param autoquick Include autosaves and quicksaves.
  * @return List of saves info.
@@ -284,19 +566,113 @@ std::vector<SaveInfo> SavedGame::getList(Language *lang, bool autoquick)
 {
 	std::vector<SaveInfo> info;
 	std::string curMaster = Options::getActiveMaster();
-	auto saves = CrossPlatform::getFolderContents(Options::getMasterUserFolder(), "sav");
+	std::string folder = Options::getMasterUserFolder();
+	auto saves = CrossPlatform::getFolderContents(folder, "sav");
+	auto asaves = CrossPlatform::getFolderContents(folder, "asav");
+	size_t numAutoquick = asaves.size();
+	saves.insert(saves.begin(), asaves.begin(), asaves.end());
 
-	if (autoquick)
+	if (saveIndexFolder != folder)
 	{
-		auto asaves = CrossPlatform::getFolderContents(Options::getMasterUserFolder(), "asav");
-		saves.insert(saves.begin(), asaves.begin(), asaves.end());
+		saveIndex = loadSaveIndex(folder + SaveIndexFile);
+		saveIndexFolder = folder;
 	}
+
+	// forget the saves that are gone
+	bool changedIndex = false;
+	std::set<std::string> present;
 	for (auto i = saves.begin(); i != saves.end(); ++i)
 	{
-		auto filename = std::get<0>(*i);
+		present.insert(std::get<0>(*i));
+	}
+	for (SaveIndex::iterator i = saveIndex.begin(); i != saveIndex.end();)
+	{
+		if (present.find(i->first) == present.end())
+		{
+			i = saveIndex.erase(i);
+			changedIndex = true;
+		}
+		else
+		{
+			++i;
+		}
+	}
+
+	// find the saves that changed since they were indexed
+	std::vector<size_t> changed;
+	std::vector<Uint64> sizes(saves.size());
+	std::vector<Uint64> heads(saves.size());
+	parallelFor(saves.size(), [&](size_t i)
+	{
+		heads[i] = hashSaveHead(folder + std::get<0>(saves[i]));
+	});
+	for (size_t i = 0; i < saves.size(); ++i)
+	{
+		const std::string &filename = std::get<0>(saves[i]);
+		sizes[i] = CrossPlatform::getFileSize(folder + filename);
+		SaveIndex::const_iterator entry = saveIndex.find(filename);
+		if (entry == saveIndex.end() || entry->second.size != sizes[i] || entry->second.timestamp != std::get<2>(saves[i]) || entry->second.head != heads[i])
+		{
+			changed.push_back(i);
+		}
+	}
+
+	std::vector<YAML::Node> briefs(changed.size());
+	std::vector<std::string> errors(changed.size());
+	parallelFor(changed.size(), [&](size_t i)
+	{
 		try
 		{
-			SaveInfo saveInfo = getSaveInfo(filename, lang);
+			briefs[i] = loadSaveBrief(folder + std::get<0>(saves[changed[i]]));
+		}
+		catch (Exception &e)
+		{
+			errors[i] = e.what();
+		}
+		catch (YAML::Exception &e)
+		{
+			errors[i] = e.what();
+		}
+		catch (std::exception &e)
+		{
+			errors[i] = e.what();
+		}
+	});
+	for (size_t i = 0; i < changed.size(); ++i)
+	{
+		const std::string &filename = std::get<0>(saves[changed[i]]);
+		if (errors[i].empty())
+		{
+			SaveIndexEntry &entry = saveIndex[filename];
+			entry.size = sizes[changed[i]];
+			entry.timestamp = std::get<2>(saves[changed[i]]);
+			entry.head = heads[changed[i]];
+			entry.brief = briefs[i];
+		}
+		else
+		{
+			Log(LOG_ERROR) << filename << ": " << errors[i];
+			saveIndex.erase(filename);
+		}
+		changedIndex = true;
+	}
+	if (changedIndex)
+	{
+		saveSaveIndex(folder + SaveIndexFile, saveIndex);
+	}
+
+	for (size_t i = autoquick ? 0 : numAutoquick; i < saves.size(); ++i)
+	{
+		const std::string &filename = std::get<0>(saves[i]);
+		SaveIndex::const_iterator entry = saveIndex.find(filename);
+		if (entry == saveIndex.end())
+		{
+			// couldn't be read, already logged
+			continue;
+		}
+		try
+		{
+			SaveInfo saveInfo = getSaveInfo(filename, entry->second.timestamp, entry->second.brief, lang);
 			if (!_isCurrentGameType(saveInfo, curMaster))
 			{
 				continue;
@@ -321,12 +697,12 @@ std::vector<SaveInfo> SavedGame::getList(Language *lang, bool autoquick)
 /**
  * Gets the info of a specific save file.
  * @param file Save filename.
+ * @param timestamp Last time the file was modified.
+ * @param doc Brief info of the save.
  * @param lang Loaded language.
  */
-SaveInfo SavedGame::getSaveInfo(const std::string &file, Language *lang)
+SaveInfo SavedGame::getSaveInfo(const std::string &file, time_t timestamp, const YAML::Node &doc, Language *lang)
 {
-	std::string fullname = Options::getMasterUserFolder() + file;
-	YAML::Node doc = YAML::Load(*CrossPlatform::getYamlSaveHeader(fullname));
 	SaveInfo save;
 
 	save.fileName = file;
@@ -359,7 +735,7 @@ SaveInfo SavedGame::getSaveInfo(const std::string &file, Language *lang)
 		save.reserved = false;
 	}
 
-	save.timestamp = CrossPlatform::getDateModified(fullname);
+	save.timestamp = timestamp;
 	std::pair<std::string, std::string> str = CrossPlatform::timeToString(save.timestamp);
 	save.isoDate = str.first;
 	save.isoTime = str.second;
@@ -389,7 +765,8 @@ SaveInfo SavedGame::getSaveInfo(const std::string &file, Language *lang)
 }
 
 /**
- * Loads a saved game's contents from a YAML file.
+ * Loads a saved game's contents from a YAML file
+ * or from a binary one, whichever it is.
  * @note Assumes the saved game is blank.
  * @param filename YAML filename.
  * @param mod Mod for the saved game.
@@ -398,7 +775,11 @@ SaveInfo SavedGame::getSaveInfo(const std::string &file, Language *lang)
 void SavedGame::load(const std::string &filename, Mod *mod, Language *lang)
 {
 	std::string filepath = Options::getMasterUserFolder() + filename;
-	std::vector<YAML::Node> file = YAML::LoadAll(*CrossPlatform::readFile(filepath));
+	std::vector<YAML::Node> file;
+	if (!loadBinarySave(filepath, file))
+	{
+		file = YAML::LoadAll(*CrossPlatform::readFile(filepath));
+	}
 	// Get brief save info
 	YAML::Node brief = file[0];
 	_time->load(brief["time"]);
@@ -778,15 +1159,87 @@ void SavedGame::load(const std::string &filename, Mod *mod, Language *lang)
 }
 
 /**
- * Saves a saved game's contents to a YAML file.
+ * Saves a saved game's contents to a YAML file,
+ * or to a binary one if the binarySaves option is on.
  * @param filename YAML filename.
+ * @param mod Mod for the saved game.
  */
 void SavedGame::save(const std::string &filename, Mod *mod) const
 {
-	YAML::Emitter out;
+	YAML::Node brief, node;
+	saveNodes(brief, node, mod);
+	writeSave(Options::getMasterUserFolder() + filename, brief, node, Options::binarySaves);
+}
+
+/**
+ * Saves a saved game's contents like save(), but only collects
+ * them here and leaves the slow part, formatting and writing the
+ * file, to a background thread. The file is written under a
+ * temporary name and then renamed, so an interrupted save never
+ * replaces a good one.
+ * @param filename YAML filename.
+ * @param mod Mod for the saved game.
+ */
+void SavedGame::saveInBackground(const std::string &filename, Mod *mod) const
+{
+	std::string error = waitForBackgroundSave();
+	if (!error.empty())
+	{
+		Log(LOG_ERROR) << error;
+	}
+
+	YAML::Node brief, node;
+	saveNodes(brief, node, mod);
+	std::string backup = filename + ".bak";
+	std::string fullPath = Options::getMasterUserFolder() + filename;
+	std::string bakPath = Options::getMasterUserFolder() + backup;
+	bool binary = Options::binarySaves;
+	backgroundSave = std::async(std::launch::async, [=]
+	{
+		writeSave(bakPath, brief, node, binary);
+		if (!CrossPlatform::moveFile(bakPath, fullPath))
+		{
+			throw Exception("Save backed up in " + backup);
+		}
+	});
+}
+
+/**
+ * Waits until the last save started by saveInBackground is written.
+ * Returns right away if there's none.
+ * @return Error message of the save, empty if it went fine.
+ */
+std::string SavedGame::waitForBackgroundSave()
+{
+	if (!backgroundSave.valid())
+	{
+		return "";
+	}
+	try
+	{
+		backgroundSave.get();
+	}
+	catch (Exception &e)
+	{
+		return e.what();
+	}
+	catch (YAML::Exception &e)
+	{
+		return e.what();
+	}
+	return "";
+}
 
+/**
+ * Collects a saved game's contents into YAML nodes.
+ * Only reads the game, the nodes don't share anything with it.
+ * @param brief Gets the brief info used in the saves list.
+ * @param node Gets the full game data.
+ * @param mod Mod for the saved game.
+ */
+void SavedGame::saveNodes(YAML::Node &brief, YAML::Node &node, Mod *mod) const
+{
 	// Saves the brief game info used in the saves list
-	YAML::Node brief;
 	brief["name"] = _name;
 	brief["version"] = OPENXCOM_VERSION_SHORT;
 	std::string git_sha = OPENXCOM_VERSION_GIT;
@@ -814,10 +1267,7 @@ void SavedGame::save(const std::string &filename, Mod *mod) const
 	brief["mods"] = modsList;
 	if (_ironman)
 		brief["ironman"] = _ironman;
-	out << brief;
 	// Saves the full game data to the save
-	out << YAML::BeginDoc;
-	YAML::Node node;
 	node["difficulty"] = (int)_difficulty;
 	node["end"] = (int)_end;
 	node["monthsPassed"] = _monthsPassed;
@@ -950,15 +1400,6 @@ void SavedGame::save(const std::string &filename, Mod *mod) const
 		node["battleGame"] = _battleGame->save();
 	}
 	_scriptValues.save(node, mod->getScriptGlobal());
-
-	out << node;
-
-
-	std::string filepath = Options::getMasterUserFolder() + filename;
-	if (!CrossPlatform::writeFile(filepath, out.c_str()))
-	{
-		throw Exception("Failed to save " + filepath);
-	}
 }
 
 /**
@@ -2460,22 +2901,37 @@ void SavedGame::setWarned(bool warned)
 	_warned = warned;
 }
 
-/** @brief Check if a point is contained in a region.
- * This function object checks if a point is contained inside a region.
+namespace
+{
+
+/**
+ * (Re)builds a lookup grid of the regions or countries
+ * from their bounding boxes, if the list has changed.
+ * Regions and countries are only ever added, on game start or load.
+ * @param grid Grid to fill.
+ * @param gridSize Number of areas in the grid.
+ * @param list List of regions or countries.
  */
-class ContainsPoint
+template<typename T>
+void updateAreaGrid(LonLatGrid<T> &grid, size_t &gridSize, const std::vector<T*> &list)
 {
-	typedef const Region* argument_type;
-	typedef bool result_type;
+	if (gridSize == list.size())
+	{
+		return;
+	}
+	gridSize = list.size();
+	grid.clear();
+	for (T *area : list)
+	{
+		auto *rules = area->getRules();
+		for (size_t i = 0; i < rules->getLonMin().size(); ++i)
+		{
+			grid.insert(area, rules->getLonMin()[i], rules->getLonMax()[i], rules->getLatMin()[i], rules->getLatMax()[i]);
+		}
+	}
+}
 
-public:
-	/// Remember the coordinates.
-	ContainsPoint(double lon, double lat) : _lon(lon), _lat(lat) { /* Empty by design. */ }
-	/// Check is the region contains the stored point.
-	bool operator()(const Region *region) const { return region->getRules()->insideRegion(_lon, _lat); }
-private:
-	double _lon, _lat;
-};
+}
 
 /**
  * Find the region containing this location.
@@ -2485,10 +2941,13 @@ private:
  */
 Region *SavedGame::locateRegion(double lon, double lat) const
 {
-	std::vector<Region *>::const_iterator found = std::find_if (_regions.begin(), _regions.end(), ContainsPoint(lon, lat));
-	if (found != _regions.end())
+	updateAreaGrid(_regionGrid, _regionGridSize, _regions);
+	for (Region *region : _regionGrid.get(lon, lat))
 	{
-		return *found;
+		if (region->getRules()->insideRegion(lon, lat))
+		{
+			return region;
+		}
 	}
 	return 0;
 }
@@ -2503,6 +2962,35 @@ Region *SavedGame::locateRegion(const Target &target) const
 	return locateRegion(target.getLongitude(), target.getLatitude());
 }
 
+/**
+ * Find the country containing this location.
+ * @param lon The longitude.
+ * @param lat The latitude.
+ * @return Pointer to the country, or 0.
+ */
+Country *SavedGame::locateCountry(double lon, double lat) const
+{
+	updateAreaGrid(_countryGrid, _countryGridSize, _countries);
+	for (Country *country : _countryGrid.get(lon, lat))
+	{
+		if (country->getRules()->insideCountry(lon, lat))
+		{
+			return country;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Find the country containing this target.
+ * @param target The target to locate.
+ * @return Pointer to the country, or 0.
+ */
+Country *SavedGame::locateCountry(const Target &target) const
+{
+	return locateCountry(target.getLongitude(), target.getLatitude());
+}
+
 /*
  * @return the month counter.
  */
@@ -2753,6 +3241,39 @@ std::vector<MissionStatistics*> *SavedGame::getMissionStatistics()
 	return &_missionStatistics;
 }
 
+/**
+ * Returns the statistics of a mission by its id.
+ * Missions are numbered in the order they're recorded, so the id
+ * is usually also the position in the list; the rest are found through
+ * an index that picks up newly recorded missions as needed.
+ * @param id Mission id.
+ * @return Pointer to the mission statistics, or 0 if there's no such mission.
+ */
+MissionStatistics *SavedGame::getMissionStatistics(int id) const
+{
+	if (id >= 0 && (size_t)id < _missionStatistics.size() && _missionStatistics[id]->id == id)
+	{
+		return _missionStatistics[id];
+	}
+	if (_missionStatisticsIndexed > _missionStatistics.size())
+	{
+		_missionStatisticsById.clear();
+		_missionStatisticsIndexed = 0;
+	}
+	for (; _missionStatisticsIndexed < _missionStatistics.size(); ++_missionStatisticsIndexed)
+	{
+		MissionStatistics *ms = _missionStatistics[_missionStatisticsIndexed];
+		// keep the first mission of a repeated id
+		_missionStatisticsById.insert(std::make_pair(ms->id, ms));
+	}
+	std::unordered_map<int, MissionStatistics*>::const_iterator i = _missionStatisticsById.find(id);
+	if (i != _missionStatisticsById.end())
+	{
+		return i->second;
+	}
+	return 0;
+}
+
 /**
 * Adds a UFO to the ignore list.
 * @param ufoId Ufo ID.
@@ -20,6 +20,7 @@
 #include <map>
 #include <vector>
 #include <set>
+#include <unordered_map>
 #include <string>
 #include <time.h>
 #include <stdint.h>
@@ -31,6 +32,7 @@
 #include "../Mod/RuleBaseFacility.h"
 #include "../Mod/Mod.h"
 #include "../Engine/Script.h"
+#include "../Engine/LonLatGrid.h"
 
 namespace OpenXcom
 {
@@ -169,9 +171,16 @@ private:
 	std::set<const RuleItem *> _autosales;
 	bool _disableSoldierEquipment;
 	bool _alienContainmentChecked;
+	mutable LonLatGrid<Country> _countryGrid;
+	mutable LonLatGrid<Region> _regionGrid;
+	mutable size_t _countryGridSize, _regionGridSize;
+	mutable std::unordered_map<int, MissionStatistics*> _missionStatisticsById;
+	mutable size_t _missionStatisticsIndexed;
 	ScriptValues<SavedGame> _scriptValues;
 
-	static SaveInfo getSaveInfo(const std::string &file, Language *lang);
+	static SaveInfo getSaveInfo(const std::string &file, time_t timestamp, const YAML::Node &doc, Language *lang);
+	/// Collects the game's contents into YAML nodes.
+	void saveNodes(YAML::Node &brief, YAML::Node &node, Mod *mod) const;
 public:
 	static const std::string AUTOSAVE_GEOSCAPE, AUTOSAVE_BATTLESCAPE, QUICKSAVE;
 	/// Creates a new saved game.
@@ -186,6 +195,10 @@ public:
 	void load(const std::string &filename, Mod *mod, Language *lang);
 	/// Saves a saved game to YAML.
 	void save(const std::string &filename, Mod *mod) const;
+	/// Saves a saved game, writing the file in the background.
+	void saveInBackground(const std::string &filename, Mod *mod) const;
+	/// Waits until the background save is written.
+	static std::string waitForBackgroundSave();
 	/// Gets the game name.
 	std::string getName() const;
 	/// Sets the game name.
@@ -362,6 +375,10 @@ public:
 	Region *locateRegion(double lon, double lat) const;
 	/// Locate a region containing a Target.
 	Region *locateRegion(const Target &target) const;
+	/// Locate a country containing a position.
+	Country *locateCountry(double lon, double lat) const;
+	/// Locate a country containing a Target.
+	Country *locateCountry(const Target &target) const;
 	/// Return the month counter.
 	int getMonthsPassed() const;
 	/// Return the GraphRegionToggles.
@@ -420,6 +437,8 @@ public:
 	ItemContainer *getGlobalCraftLoadout(int index);
 	/// Gets the list of missions statistics
 	std::vector<MissionStatistics*> *getMissionStatistics();
+	/// Gets the statistics of a mission by id.
+	MissionStatistics *getMissionStatistics(int id) const;
 	/// Adds a UFO to the ignore list.
 	void addUfoToIgnoreList(int ufoId);
 	/// Checks if a UFO is on the ignore list.
@@ -20,6 +20,7 @@
 #include <assert.h>
 #include <sstream>
 #include <cfloat>
+#include <cstring>
 
 namespace OpenXcom
 {
@@ -107,4 +108,122 @@ std::string serializeDouble(double value)
 	return stream.str();
 }
 
+/**
+ * Packs an array of fixed-size records into a much smaller form.
+ * The records are split into byte columns (all the first bytes,
+ * then all the second bytes...), each byte is replaced by its
+ * difference with the one of the previous record, and the
+ * result is run-length encoded. Neighbouring records tend to
+ * hold the same or increasing values, so this leaves mostly
+ * long runs of zeroes.
+ * @param data Records to pack.
+ * @param count Number of records.
+ * @param size Size of each record in bytes.
+ * @return Packed data.
+ */
+std::vector<Uint8> packRecords(const Uint8 *data, size_t count, size_t size)
+{
+	std::vector<Uint8> columns(count * size);
+	for (size_t b = 0; b < size; ++b)
+	{
+		Uint8 prev = 0;
+		for (size_t r = 0; r < count; ++r)
+		{
+			Uint8 value = data[r * size + b];
+			columns[b * count + r] = value - prev;
+			prev = value;
+		}
+	}
+
+	// control byte below 128: that many + 1 bytes copied as is follow,
+	// otherwise the following byte is repeated that many - 125 times
+	std::vector<Uint8> packed;
+	size_t i = 0, total = columns.size();
+	while (i < total)
+	{
+		size_t run = 1;
+		while (i + run < total && run < 130 && columns[i + run] == columns[i])
+		{
+			++run;
+		}
+		if (run >= 3)
+		{
+			packed.push_back(run + 125);
+			packed.push_back(columns[i]);
+			i += run;
+		}
+		else
+		{
+			size_t start = i;
+			while (i < total && i - start < 128)
+			{
+				if (i + 2 < total && columns[i] == columns[i + 1] && columns[i] == columns[i + 2])
+				{
+					break;
+				}
+				++i;
+			}
+			packed.push_back(i - start - 1);
+			packed.insert(packed.end(), columns.begin() + start, columns.begin() + i);
+		}
+	}
+	return packed;
+}
+
+/**
+ * Restores an array of fixed-size records packed by packRecords.
+ * @param packed Packed data.
+ * @param packedSize Size of the packed data in bytes.
+ * @param data Buffer for the records, count * size bytes.
+ * @param count Number of records.
+ * @param size Size of each record in bytes.
+ * @return False if the packed data doesn't match the records.
+ */
+bool unpackRecords(const Uint8 *packed, size_t packedSize, Uint8 *data, size_t count, size_t size)
+{
+	std::vector<Uint8> columns(count * size);
+	const Uint8 *end = packed + packedSize;
+	size_t i = 0, total = columns.size();
+	while (i < total)
+	{
+		if (packed == end)
+		{
+			return false;
+		}
+		Uint8 control = *packed++;
+		if (control < 128)
+		{
+			size_t length = control + 1;
+			if ((size_t)(end - packed) < length || total - i < length)
+			{
+				return false;
+			}
+			memcpy(&columns[i], packed, length);
+			packed += length;
+			i += length;
+		}
+		else
+		{
+			size_t length = control - 125;
+			if (packed == end || total - i < length)
+			{
+				return false;
+			}
+			memset(&columns[i], *packed++, length);
+			i += length;
+		}
+	}
+
+	for (size_t b = 0; b < size; ++b)
+	{
+		Uint8 prev = 0;
+		for (size_t r = 0; r < count; ++r)
+		{
+			prev += columns[b * count + r];
+			data[r * size + b] = prev;
+		}
+	}
+	return packed == end;
+}
+
 }
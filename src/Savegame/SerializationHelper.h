@@ -19,6 +19,7 @@
  */
 #include <SDL_types.h>
 #include <string>
+#include <vector>
 
 namespace OpenXcom
 {
@@ -26,5 +27,7 @@ namespace OpenXcom
 int unserializeInt(Uint8 **buffer, Uint8 sizeKey);
 void serializeInt(Uint8 **buffer, Uint8 sizeKey, int value);
 std::string serializeDouble(double value);
+std::vector<Uint8> packRecords(const Uint8 *data, size_t count, size_t size);
+bool unpackRecords(const Uint8 *packed, size_t packedSize, Uint8 *data, size_t count, size_t size);
 
 }
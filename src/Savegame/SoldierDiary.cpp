@@ -23,6 +23,8 @@
 #include "BattleUnitStatistics.h"
 #include "MissionStatistics.h"
 #include <algorithm>
+#include <unordered_map>
+#include <limits>
 
 namespace OpenXcom
 {
@@ -273,7 +275,58 @@ bool SoldierDiary::manageCommendations(Mod *mod, std::vector<MissionStatistics*>
 		"DT_STUN", "DT_MELEE", "DT_ACID", "DT_SMOKE",
 		"DT_10", "DT_11", "DT_12", "DT_13", "DT_14", "DT_15", "DT_16", "DT_17", "DT_18", "DT_19", "DT_END" };
 
-	const std::map<std::string, RuleCommendations *> commendationsList = mod->getCommendationsList();
+	const std::map<std::string, RuleCommendations *> &commendationsList = mod->getCommendationsList();
+	const MissionTotals &missionTotals = getMissionTotals(missionStatistics, mod);
+	// Totals checked by the criteria without nouns, worked out once for all the commendations.
+	const std::unordered_map<std::string, int> criteriaTotals = {
+		{ "totalKills", getKillTotal() },
+		{ "totalMissions", getMissionTotal() },
+		{ "totalWins", missionTotals.wins },
+		{ "totalScore", missionTotals.score },
+		{ "totalStuns", getStunTotal() },
+		{ "totalDaysWounded", _daysWoundedTotal },
+		{ "totalBaseDefenseMissions", missionTotals.baseDefense },
+		{ "totalTerrorMissions", missionTotals.terror },
+		{ "totalNightMissions", missionTotals.night },
+		{ "totalNightTerrorMissions", missionTotals.nightTerror },
+		{ "totalMonthlyService", _monthsService },
+		{ "totalFellUnconcious", _unconciousTotal },
+		{ "totalShotAt10Times", _shotAtCounter10in1Mission },
+		{ "totalHit5Times", _hitCounter5in1Mission },
+		// never awarded to the dead or missing
+		{ "totalFriendlyFired", (_KIA || _MIA) ? std::numeric_limits<int>::min() : _totalShotByFriendlyCounter },
+		{ "total_lone_survivor", _loneSurvivorTotal },
+		{ "totalIronMan", _ironManTotal },
+		{ "totalImportantMissions", missionTotals.important },
+		{ "totalLongDistanceHits", _longDistanceHitCounterTotal },
+		{ "totalLowAccuracyHits", _lowAccuracyHitCounterTotal },
+		{ "totalReactionFire", getReactionFireKillTotal(mod) },
+		{ "totalTimesWounded", _timesWoundedTotal },
+		{ "totalValientCrux", missionTotals.valiantCrux },
+		{ "isDead", _KIA },
+		{ "totalTrapKills", getTrapKillTotal(mod) },
+		{ "totalAlienBaseAssaults", missionTotals.alienBase },
+		{ "totalAllAliensKilled", _allAliensKilledTotal },
+		{ "totalAllAliensStunned", _allAliensStunnedTotal },
+		{ "totalWoundsHealed", _woundsHealedTotal },
+		{ "totalAllUFOs", _allUFOs },
+		{ "totalAllMissionTypes", _allMissionTypes },
+		{ "totalStatGain", _statGainTotal },
+		{ "totalRevives", _revivedUnitTotal },
+		{ "totalSoldierRevives", _revivedSoldierTotal },
+		{ "totalHostileRevives", _revivedHostileTotal },
+		{ "totalNeutralRevives", _revivedNeutralTotal },
+		{ "totalWholeMedikit", _wholeMedikitTotal },
+		{ "totalBraveryGain", _braveryGainTotal },
+		{ "bestOfRank", _bestOfRank },
+		{ "bestSoldier", (int)_bestSoldier },
+		{ "isMIA", _MIA },
+		{ "totalMartyrKills", _martyrKillsTotal },
+		{ "totalPostMortemKills", _postMortemKills },
+		{ "globeTrotter", (int)_globeTrotter },
+		{ "totalSlaveKills", _slaveKillsTotal },
+	};
+	std::unordered_map<std::string, std::map<std::string, int> > nounTotals; // Criteria, noun totals; filled when first needed.
 	bool awardedCommendation = false;                   // This value is returned if at least one commendation was given.
 	std::map<std::string, int> nextCommendationLevel;   // Noun, threshold.
 	std::vector<std::string> modularCommendations;      // Commendation name.
@@ -305,71 +358,33 @@ bool SoldierDiary::manageCommendations(Mod *mod, std::vector<MissionStatistics*>
 				break;
 			}
 			// These criteria have no nouns, so only the nextCommendationLevel["noNoun"] will ever be used.
-			else if( nextCommendationLevel.count("noNoun") == 1 &&
-				  ( ((*j).first == "totalKills" && (unsigned int)getKillTotal() < (unsigned int)(*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalMissions" && _missionIdList.size() < (unsigned int)(*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalWins" && getWinTotal(missionStatistics) < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalScore" && getScoreTotal(missionStatistics) < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalStuns" && getStunTotal() < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalDaysWounded" && _daysWoundedTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalBaseDefenseMissions" && getBaseDefenseMissionTotal(missionStatistics) < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalTerrorMissions" && getTerrorMissionTotal(missionStatistics) < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalNightMissions" && getNightMissionTotal(missionStatistics, mod) < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalNightTerrorMissions" && getNightTerrorMissionTotal(missionStatistics, mod) < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalMonthlyService" && _monthsService < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalFellUnconcious" && _unconciousTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalShotAt10Times" && _shotAtCounter10in1Mission < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalHit5Times" && _hitCounter5in1Mission < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalFriendlyFired" && (_totalShotByFriendlyCounter < (*j).second.at(nextCommendationLevel["noNoun"]) || _KIA || _MIA)) ||
-					((*j).first == "total_lone_survivor" && _loneSurvivorTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalIronMan" && _ironManTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalImportantMissions" && getImportantMissionTotal(missionStatistics) < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalLongDistanceHits" && _longDistanceHitCounterTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalLowAccuracyHits" && _lowAccuracyHitCounterTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalReactionFire" && getReactionFireKillTotal(mod) < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalTimesWounded" && _timesWoundedTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalDaysWounded" && _daysWoundedTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalValientCrux" && getValiantCruxTotal(missionStatistics) < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "isDead" && _KIA < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalTrapKills" && getTrapKillTotal(mod) < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalAlienBaseAssaults" && getAlienBaseAssaultTotal(missionStatistics) < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalAllAliensKilled" && _allAliensKilledTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalAllAliensStunned" && _allAliensStunnedTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalWoundsHealed" && _woundsHealedTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalAllUFOs" && _allUFOs < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalAllMissionTypes" && _allMissionTypes < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalStatGain" && _statGainTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalRevives" && _revivedUnitTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalSoldierRevives" && _revivedSoldierTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalHostileRevives" && _revivedHostileTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalNeutralRevives" && _revivedNeutralTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalWholeMedikit" && _wholeMedikitTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalBraveryGain" && _braveryGainTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "bestOfRank" && _bestOfRank < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "bestSoldier" && (int)_bestSoldier < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "isMIA" && _MIA < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalMartyrKills" && _martyrKillsTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalPostMortemKills" && _postMortemKills < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "globeTrotter" && (int)_globeTrotter < (*j).second.at(nextCommendationLevel["noNoun"])) ||
-					((*j).first == "totalSlaveKills" && _slaveKillsTotal < (*j).second.at(nextCommendationLevel["noNoun"])) ) )
-
+			std::unordered_map<std::string, int>::const_iterator criteriaTotal = criteriaTotals.find((*j).first);
+			if (criteriaTotal != criteriaTotals.end())
 			{
-				awardCommendationBool = false;
-				break;
+				if (criteriaTotal->second < (*j).second.at(nextCommendationLevel["noNoun"]))
+				{
+					awardCommendationBool = false;
+					break;
+				}
 			}
 			// Medals with the following criteria are unique because they need a noun.
 			// And because they loop over a map<> (this allows for maximum moddability).
 			else if ((*j).first == "totalKillsWithAWeapon" || (*j).first == "totalMissionsInARegion" || (*j).first == "totalKillsByRace" || (*j).first == "totalKillsByRank")
 			{
-				std::map<std::string, int> tempTotal;
-				if ((*j).first == "totalKillsWithAWeapon")
-					tempTotal = getWeaponTotal();
-				else if ((*j).first == "totalMissionsInARegion")
-					tempTotal = getRegionTotal(missionStatistics);
-				else if ((*j).first == "totalKillsByRace")
-					tempTotal = getAlienRaceTotal();
-				else if ((*j).first == "totalKillsByRank")
-					tempTotal = getAlienRankTotal();
+				std::unordered_map<std::string, std::map<std::string, int> >::iterator cached = nounTotals.find((*j).first);
+				if (cached == nounTotals.end())
+				{
+					cached = nounTotals.insert(std::make_pair((*j).first, std::map<std::string, int>())).first;
+					if ((*j).first == "totalKillsWithAWeapon")
+						cached->second = getWeaponTotal();
+					else if ((*j).first == "totalMissionsInARegion")
+						cached->second = missionTotals.region;
+					else if ((*j).first == "totalKillsByRace")
+						cached->second = getAlienRaceTotal();
+					else if ((*j).first == "totalKillsByRank")
+						cached->second = getAlienRankTotal();
+				}
+				const std::map<std::string, int> &tempTotal = cached->second;
 				// Loop over the temporary map.
 				// Match nouns and decoration levels.
 				for(std::map<std::string, int>::const_iterator k = tempTotal.begin(); k != tempTotal.end(); ++k)
@@ -422,6 +437,30 @@ bool SoldierDiary::manageCommendations(Mod *mod, std::vector<MissionStatistics*>
 						if ((*j).first == "killsWithCriteriaTurn" || (*j).first == "killsWithCriteriaMission")
 							detailCount++; // Turns and missions start at 1 because of how thisTime and lastTime work.
 
+						// Match the DETAILs to battle and damage types once, not for every kill.
+						std::vector<std::pair<int, int> > detailTypes;
+						for (std::vector<std::string>::const_iterator detail = andCriteria->second.begin(); detail != andCriteria->second.end(); ++detail)
+						{
+							int battleType = 0;
+							for (; battleType != BATTLE_TYPES; ++battleType)
+							{
+								if ((*detail) == battleTypeArray[battleType])
+								{
+									break;
+								}
+							}
+
+							int damageType = 0;
+							for (; damageType != DAMAGE_TYPES; ++damageType)
+							{
+								if ((*detail) == damageTypeArray[damageType])
+								{
+									break;
+								}
+							}
+							detailTypes.push_back(std::make_pair(battleType, damageType));
+						}
+
 						// Loop over the KILLS.
 						for (std::vector<BattleUnitKills*>::const_iterator singleKill = _killList.begin(); singleKill != _killList.end(); ++singleKill)
 						{
@@ -461,29 +500,14 @@ bool SoldierDiary::manageCommendations(Mod *mod, std::vector<MissionStatistics*>
 							}
 
 							// Loop over the DETAILs of one AND vector.
+							RuleItem *weapon = mod->getItem((*singleKill)->weapon);
+							RuleItem *weaponAmmo = mod->getItem((*singleKill)->weaponAmmo);
 							for (std::vector<std::string>::const_iterator detail = andCriteria->second.begin(); detail != andCriteria->second.end(); ++detail)
 							{
-								int battleType = 0;
-								for (; battleType != BATTLE_TYPES; ++battleType)
-								{
-									if ((*detail) == battleTypeArray[battleType])
-									{
-										break;
-									}
-								}
-
-								int damageType = 0;
-								for (; damageType != DAMAGE_TYPES; ++damageType)
-								{
-									if ((*detail) == damageTypeArray[damageType])
-									{
-										break;
-									}
-								}
+								int battleType = detailTypes[detail - andCriteria->second.begin()].first;
+								int damageType = detailTypes[detail - andCriteria->second.begin()].second;
 
 								// See if we find _no_ matches with any criteria. If so, break and try the next kill.
-								RuleItem *weapon = mod->getItem((*singleKill)->weapon);
-								RuleItem *weaponAmmo = mod->getItem((*singleKill)->weaponAmmo);
 								if (weapon == 0 || weaponAmmo == 0 ||
 									((*singleKill)->rank != (*detail) && (*singleKill)->race != (*detail) &&
 									 (*singleKill)->weapon != (*detail) && (*singleKill)->weaponAmmo != (*detail) &&
@@ -651,25 +675,82 @@ std::map<std::string, int> SoldierDiary::getWeaponAmmoTotal()
 }
 
 /**
- *  Get a map of the amount of missions done in each region.
- *  @param MissionStatistics
+ * Gets the totals over the missions the soldier took part in.
+ * They are counted in a single pass over the mission statistics and
+ * kept until either list grows, so the many getters used to award
+ * commendations don't each have to search all the missions again.
+ * @param missionStatistics List of all the mission statistics.
+ * @param mod Mod for the darkness check of night missions, or null if not needed.
+ * @return Mission totals.
  */
-std::map<std::string, int> SoldierDiary::getRegionTotal(std::vector<MissionStatistics*> *missionStatistics) const
+const SoldierDiary::MissionTotals &SoldierDiary::getMissionTotals(std::vector<MissionStatistics*> *missionStatistics, const Mod *mod) const
 {
-	std::map<std::string, int> regionTotal;
-
+	if (_totalsSource == missionStatistics && _totalsStatistics == missionStatistics->size() && _totalsMissions == _missionIdList.size() && (mod == 0 || mod == _totalsMod))
+	{
+		return _missionTotals;
+	}
+	if (mod == 0)
+	{
+		mod = _totalsMod;
+	}
+	_totalsSource = missionStatistics;
+	_totalsMod = mod;
+	_totalsStatistics = missionStatistics->size();
+	_totalsMissions = _missionIdList.size();
+	_missionTotals = MissionTotals();
+
+	std::unordered_map<int, int> missionIds;
+	for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
+	{
+		missionIds[*j]++;
+	}
 	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
 	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
+		std::unordered_map<int, int>::const_iterator found = missionIds.find((*i)->id);
+		if (found == missionIds.end())
 		{
-			if ((*j) == (*i)->id)
-			{
-				regionTotal[(*i)->region]++;
-			}
+			continue;
 		}
+		// the same mission can be listed more than once, count it every time
+		int times = found->second;
+		bool night = mod != 0 && (*i)->isDarkness(mod);
+		_missionTotals.region[(*i)->region] += times;
+		_missionTotals.country[(*i)->country] += times;
+		_missionTotals.type[(*i)->type] += times;
+		_missionTotals.ufo[(*i)->ufo] += times;
+		_missionTotals.score += (*i)->score * times;
+		_missionTotals.loot += (*i)->lootValue * times;
+		if ((*i)->valiantCrux)
+			_missionTotals.valiantCrux += times;
+		if (!(*i)->success)
+			continue;
+		_missionTotals.wins += times;
+		if ((*i)->type != "STR_UFO_CRASH_RECOVERY")
+			_missionTotals.important += times;
+		if ((*i)->isBaseDefense())
+			_missionTotals.baseDefense += times;
+		if ((*i)->isAlienBase())
+			_missionTotals.alienBase += times;
+		// Not a UFO, not the base, not the alien base or colony
+		bool terror = !(*i)->isBaseDefense() && !(*i)->isUfoMission() && !(*i)->isAlienBase();
+		if (terror)
+			_missionTotals.terror += times;
+		if (night && !(*i)->isBaseDefense() && !(*i)->isAlienBase())
+			_missionTotals.night += times;
+		if (night && terror)
+			_missionTotals.nightTerror += times;
 	}
 
-	return regionTotal;
+	return _missionTotals;
+}
+
+/**
+ *  Get a map of the amount of missions done in each region.
+ *  @param MissionStatistics
+ */
+std::map<std::string, int> SoldierDiary::getRegionTotal(std::vector<MissionStatistics*> *missionStatistics) const
+{
+	return getMissionTotals(missionStatistics, nullptr).region;
 }
 
 /**
@@ -678,20 +759,7 @@ std::map<std::string, int> SoldierDiary::getRegionTotal(std::vector<MissionStati
  */
 std::map<std::string, int> SoldierDiary::getCountryTotal(std::vector<MissionStatistics*> *missionStatistics) const
 {
-	std::map<std::string, int> countryTotal;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				countryTotal[(*i)->country]++;
-			}
-		}
-	}
-
-	return countryTotal;
+	return getMissionTotals(missionStatistics, nullptr).country;
 }
 
 /**
@@ -700,20 +768,7 @@ std::map<std::string, int> SoldierDiary::getCountryTotal(std::vector<MissionStat
  */
 std::map<std::string, int> SoldierDiary::getTypeTotal(std::vector<MissionStatistics*> *missionStatistics) const
 {
-	std::map<std::string, int> typeTotal;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				typeTotal[(*i)->type]++;
-			}
-		}
-	}
-
-	return typeTotal;
+	return getMissionTotals(missionStatistics, nullptr).type;
 }
 
 /**
@@ -722,20 +777,7 @@ std::map<std::string, int> SoldierDiary::getTypeTotal(std::vector<MissionStatist
  */
 std::map<std::string, int> SoldierDiary::getUFOTotal(std::vector<MissionStatistics*> *missionStatistics) const
 {
-	std::map<std::string, int> ufoTotal;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				ufoTotal[(*i)->ufo]++;
-			}
-		}
-	}
-
-	return ufoTotal;
+	return getMissionTotals(missionStatistics, nullptr).ufo;
 }
 
 /**
@@ -770,23 +812,7 @@ int SoldierDiary::getMissionTotal() const
  */
 int SoldierDiary::getWinTotal(std::vector<MissionStatistics*> *missionStatistics) const
 {
-	int winTotal = 0;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				if ((*i)->success)
-				{
-					winTotal++;
-				}
-			}
-		}
-	}
-
-	return winTotal;
+	return getMissionTotals(missionStatistics, nullptr).wins;
 }
 
 /**
@@ -970,24 +996,7 @@ int SoldierDiary::getTrapKillTotal(Mod *mod) const
  */
 int SoldierDiary::getTerrorMissionTotal(std::vector<MissionStatistics*> *missionStatistics) const
 {
-	/// Not a UFO, not the base, not the alien base or colony
-	int terrorMissionTotal = 0;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				if ((*i)->success && !(*i)->isBaseDefense() && !(*i)->isUfoMission() && !(*i)->isAlienBase())
-				{
-					terrorMissionTotal++;
-				}
-			}
-		}
-	}
-
-	return terrorMissionTotal;
+	return getMissionTotals(missionStatistics, nullptr).terror;
 }
 
 /**
@@ -996,23 +1005,7 @@ int SoldierDiary::getTerrorMissionTotal(std::vector<MissionStatistics*> *mission
  */
 int SoldierDiary::getNightMissionTotal(std::vector<MissionStatistics*> *missionStatistics, const Mod* mod) const
 {
-	int nightMissionTotal = 0;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				if ((*i)->success && (*i)->isDarkness(mod) && !(*i)->isBaseDefense() && !(*i)->isAlienBase())
-				{
-					nightMissionTotal++;
-				}
-			}
-		}
-	}
-
-	return nightMissionTotal;
+	return getMissionTotals(missionStatistics, mod).night;
 }
 
 /**
@@ -1021,23 +1014,7 @@ int SoldierDiary::getNightMissionTotal(std::vector<MissionStatistics*> *missionS
  */
 int SoldierDiary::getNightTerrorMissionTotal(std::vector<MissionStatistics*> *missionStatistics, const Mod* mod) const
 {
-	int nightTerrorMissionTotal = 0;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				if ((*i)->success && (*i)->isDarkness(mod) && !(*i)->isBaseDefense() && !(*i)->isUfoMission() && !(*i)->isAlienBase())
-				{
-					nightTerrorMissionTotal++;
-				}
-			}
-		}
-	}
-
-	return nightTerrorMissionTotal;
+	return getMissionTotals(missionStatistics, mod).nightTerror;
 }
 
 /**
@@ -1046,23 +1023,7 @@ int SoldierDiary::getNightTerrorMissionTotal(std::vector<MissionStatistics*> *mi
  */
 int SoldierDiary::getBaseDefenseMissionTotal(std::vector<MissionStatistics*> *missionStatistics) const
 {
-	int baseDefenseMissionTotal = 0;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				if ((*i)->success && (*i)->isBaseDefense())
-				{
-					baseDefenseMissionTotal++;
-				}
-			}
-		}
-	}
-
-	return baseDefenseMissionTotal;
+	return getMissionTotals(missionStatistics, nullptr).baseDefense;
 }
 
 /**
@@ -1071,23 +1032,7 @@ int SoldierDiary::getBaseDefenseMissionTotal(std::vector<MissionStatistics*> *mi
  */
 int SoldierDiary::getAlienBaseAssaultTotal(std::vector<MissionStatistics*> *missionStatistics) const
 {
-	int alienBaseAssaultTotal = 0;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				if ((*i)->success && (*i)->isAlienBase())
-				{
-					alienBaseAssaultTotal++;
-				}
-			}
-		}
-	}
-
-	return alienBaseAssaultTotal;
+	return getMissionTotals(missionStatistics, nullptr).alienBase;
 }
 
 /**
@@ -1096,23 +1041,7 @@ int SoldierDiary::getAlienBaseAssaultTotal(std::vector<MissionStatistics*> *miss
  */
 int SoldierDiary::getImportantMissionTotal(std::vector<MissionStatistics*> *missionStatistics) const
 {
-	int importantMissionTotal = 0;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				if ((*i)->success && (*i)->type != "STR_UFO_CRASH_RECOVERY")
-				{
-					importantMissionTotal++;
-				}
-			}
-		}
-	}
-
-	return importantMissionTotal;
+	return getMissionTotals(missionStatistics, nullptr).important;
 }
 
 /**
@@ -1121,20 +1050,7 @@ int SoldierDiary::getImportantMissionTotal(std::vector<MissionStatistics*> *miss
  */
 int SoldierDiary::getScoreTotal(std::vector<MissionStatistics*> *missionStatistics) const
 {
-	int scoreTotal = 0;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				scoreTotal += (*i)->score;
-			}
-		}
-	}
-
-	return scoreTotal;
+	return getMissionTotals(missionStatistics, nullptr).score;
 }
 
 /**
@@ -1143,20 +1059,7 @@ int SoldierDiary::getScoreTotal(std::vector<MissionStatistics*> *missionStatisti
  */
 int SoldierDiary::getValiantCruxTotal(std::vector<MissionStatistics*> *missionStatistics) const
 {
-	int valiantCruxTotal = 0;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id && (*i)->valiantCrux)
-			{
-				valiantCruxTotal++;
-			}
-		}
-	}
-
-	return valiantCruxTotal;
+	return getMissionTotals(missionStatistics, nullptr).valiantCrux;
 }
 
 /**
@@ -1165,20 +1068,7 @@ int SoldierDiary::getValiantCruxTotal(std::vector<MissionStatistics*> *missionSt
  */
 int SoldierDiary::getLootValueTotal(std::vector<MissionStatistics*> *missionStatistics) const
 {
-	int lootValueTotal = 0;
-
-	for (std::vector<MissionStatistics*>::const_iterator i = missionStatistics->begin(); i != missionStatistics->end(); ++i)
-	{
-		for (std::vector<int>::const_iterator j = _missionIdList.begin(); j != _missionIdList.end(); ++j)
-		{
-			if ((*j) == (*i)->id)
-			{
-				lootValueTotal += (*i)->lootValue;
-			}
-		}
-	}
-
-	return lootValueTotal;
+	return getMissionTotals(missionStatistics, nullptr).loot;
 }
 
 /**
@@ -86,6 +86,21 @@ private:
 		_woundsHealedTotal, _allUFOs, _allMissionTypes, _statGainTotal, _revivedUnitTotal, _wholeMedikitTotal, _braveryGainTotal, _bestOfRank, _MIA,
 		_martyrKillsTotal, _postMortemKills, _slaveKillsTotal, _bestSoldier, _revivedSoldierTotal, _revivedHostileTotal, _revivedNeutralTotal;
 	bool _globeTrotter;
+
+	/// Totals over the missions the soldier took part in.
+	struct MissionTotals
+	{
+		std::map<std::string, int> region, country, type, ufo;
+		int wins = 0, score = 0, terror = 0, night = 0, nightTerror = 0, baseDefense = 0, alienBase = 0, important = 0, valiantCrux = 0, loot = 0;
+	};
+	mutable MissionTotals _missionTotals;
+	/// What the totals were counted from: the statistics list, the mod and both list sizes.
+	/// Both lists only ever grow, so there's no hash of the mission ids.
+	mutable const std::vector<MissionStatistics*> *_totalsSource = nullptr;
+	mutable const Mod *_totalsMod = nullptr;
+	mutable size_t _totalsStatistics = 0, _totalsMissions = 0;
+	/// Gets the mission totals, recounting them if anything changed.
+	const MissionTotals &getMissionTotals(std::vector<MissionStatistics*> *missionStatistics, const Mod *mod) const;
 	void manageModularCommendations(std::map<std::string, int> &nextCommendationLevel, std::map<std::string, int> &modularCommendations, std::pair<std::string, int> statTotal, int criteria);
 public:
 	/// Construct a diary.
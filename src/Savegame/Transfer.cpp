@@ -306,7 +306,7 @@ void Transfer::advance(Base *base)
 		}
 		else if (_craft != 0)
 		{
-			base->getCrafts()->push_back(_craft);
+			base->addCraft(_craft);
 			_craft->setBase(base);
 			_craft->checkup();
 		}
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "UfoDetector.h"
+#include <algorithm>
+#include <cmath>
+#include "../fmath.h"
+#include "Base.h"
+#include "Craft.h"
+#include "Ufo.h"
+#include "../Mod/RuleUfo.h"
+#include "../Mod/ModScript.h"
+#include "../Engine/RNG.h"
+
+namespace OpenXcom
+{
+
+namespace
+{
+
+/**
+ * Gets the cosine of the angular distance matching a radar range.
+ * Detection truncates distances to whole nautical miles,
+ * so one extra mile keeps every source that could still reach.
+ * @param range Range in nautical miles.
+ * @return Cosine of the range angle.
+ */
+double rangeCos(int range)
+{
+	return cos(std::min(Nautical(range + 1), M_PI));
+}
+
+/**
+ * Uses up the random number a skipped source would have rolled.
+ * Base::detect and Craft::detect always end with an RNG::percent
+ * check, even at 0% chance, so skipping them must take the same
+ * draw to keep games from the same seed or save playing out the same.
+ */
+void skipDetectRoll()
+{
+	RNG::generate(0, 99);
+}
+
+}
+
+/**
+ * Gathers the position and maximum radar range of every source.
+ * @param bases List of X-Com bases.
+ * @param crafts List of airborne X-Com craft.
+ */
+UfoDetector::UfoDetector(const std::vector<Base*> &bases, const std::vector<Craft*> &crafts) : _bases(bases), _crafts(crafts)
+{
+	size_t total = _bases.size() + _crafts.size();
+	_x.reserve(total);
+	_y.reserve(total);
+	_z.reserve(total);
+	_rangeCos.reserve(total);
+	_inRange.resize(total);
+
+	auto addSource = [&](double lon, double lat, int range)
+	{
+		_x.push_back(cos(lat) * cos(lon));
+		_y.push_back(cos(lat) * sin(lon));
+		_z.push_back(sin(lat));
+		_rangeCos.push_back(rangeCos(range));
+	};
+	for (Base *base : _bases)
+	{
+		addSource(base->getLongitude(), base->getLatitude(), base->getMaxRadarRange());
+	}
+	for (Craft *craft : _crafts)
+	{
+		addSource(craft->getLongitude(), craft->getLatitude(), craft->getCraftStats().radarRange);
+	}
+}
+
+/**
+ * Checks a UFO against all the radar sources in range.
+ * Sources out of range can never detect the UFO, unless
+ * a detection script is involved, in which case every
+ * source is checked as before. Skipped sources still draw
+ * their random number, so the RNG sequence doesn't change.
+ * @param ufo Pointer to the UFO.
+ * @param alreadyTracked Was the UFO already detected.
+ * @return Combined detection result.
+ */
+UfoDetection UfoDetector::detect(const Ufo *ufo, bool alreadyTracked)
+{
+	const double ux = cos(ufo->getLatitude()) * cos(ufo->getLongitude());
+	const double uy = cos(ufo->getLatitude()) * sin(ufo->getLongitude());
+	const double uz = sin(ufo->getLatitude());
+	const size_t total = _rangeCos.size();
+	const size_t bases = _bases.size();
+
+	for (size_t i = 0; i < total; ++i)
+	{
+		_inRange[i] = (ux * _x[i] + uy * _y[i] + uz * _z[i]) >= _rangeCos[i];
+	}
+
+	const bool allBases = !ufo->getRules()->getScript<ModScript::DetectUfoFromBase>().empty();
+	const bool allCrafts = !ufo->getRules()->getScript<ModScript::DetectUfoFromCraft>().empty();
+
+	int detected = DETECTION_NONE;
+	for (size_t i = 0; i < bases; ++i)
+	{
+		if (allBases || _inRange[i])
+		{
+			detected |= _bases[i]->detect(ufo, alreadyTracked);
+		}
+		else
+		{
+			skipDetectRoll();
+		}
+	}
+	for (size_t i = bases; i < total; ++i)
+	{
+		if (allCrafts || _inRange[i])
+		{
+			detected |= _crafts[i - bases]->detect(ufo, alreadyTracked);
+		}
+		else
+		{
+			skipDetectRoll();
+		}
+	}
+	return (UfoDetection)detected;
+}
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <vector>
+
+namespace OpenXcom
+{
+
+class Base;
+class Craft;
+class Ufo;
+
+enum UfoDetection : int;
+
+/**
+ * Runs a UFO detection pass against all the X-Com radars.
+ * The radar sources (bases and airborne craft) are gathered once
+ * per detection interval together with their maximum range, so each
+ * UFO only runs the full detection check against the sources that
+ * can actually reach it.
+ */
+class UfoDetector
+{
+private:
+	std::vector<Base*> _bases;
+	std::vector<Craft*> _crafts;
+	/// Source positions as unit vectors and the cosine of their max range, bases first.
+	std::vector<double> _x, _y, _z, _rangeCos;
+	std::vector<char> _inRange;
+public:
+	/// Gathers the radar sources.
+	UfoDetector(const std::vector<Base*> &bases, const std::vector<Craft*> &crafts);
+	/// Checks if a UFO is detected by any radar source.
+	UfoDetection detect(const Ufo *ufo, bool alreadyTracked);
+};
+
+}
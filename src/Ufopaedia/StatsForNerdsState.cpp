@@ -336,6 +336,42 @@ void StatsForNerdsState::initLists()
 	_counter = 0;
 	_indent = false;
 
+	// the rule and language can't change while we're here, so each page only needs to be built once
+	int pageId = (_showDebug ? 1 : 0) | (_showIds ? 2 : 0) | (_showDefaults ? 4 : 0);
+	std::map<int, CachedPage>::const_iterator cached = _cachedPages.find(pageId);
+	if (cached != _cachedPages.end())
+	{
+		_lstRawData->clearList();
+		_txtArticle->setText(cached->second.article);
+		// the related items can depend on the toggles too, e.g. debug-only built-in weapons
+		_filterOptions = cached->second.filterOptions;
+		if (!_filterOptions.empty())
+		{
+			_cbxRelatedStuff->setOptions(_filterOptions, true);
+		}
+		_cbxRelatedStuff->setVisible(cached->second.filterVisible);
+		_txtTitle->setAlign(cached->second.titleAlign);
+		for (std::vector<CachedRow>::const_iterator i = cached->second.rows.begin(); i != cached->second.rows.end(); ++i)
+		{
+			if (i->cells.size() == 1)
+			{
+				_lstRawData->setFlooding(true);
+				_lstRawData->addRow(1, i->cells[0].c_str());
+				_lstRawData->setFlooding(false);
+			}
+			else
+			{
+				_lstRawData->addRow(2, i->cells[0].c_str(), i->cells[1].c_str());
+			}
+			size_t row = _lstRawData->getTexts() - 1;
+			for (size_t col = 0; col < i->colors.size(); ++col)
+			{
+				_lstRawData->setCellColor(row, col, i->colors[col]);
+			}
+		}
+		return;
+	}
+
 	switch (_typeId)
 	{
 	case UFOPAEDIA_TYPE_ITEM:
@@ -367,6 +403,21 @@ void StatsForNerdsState::initLists()
 	default:
 		break;
 	}
+
+	CachedPage &page = _cachedPages[pageId];
+	page.article = _txtArticle->getText();
+	page.filterOptions = _filterOptions;
+	page.filterVisible = _cbxRelatedStuff->getVisible();
+	page.titleAlign = _txtTitle->getAlign();
+	page.rows.resize(_lstRawData->getTexts());
+	for (size_t row = 0; row < page.rows.size(); ++row)
+	{
+		for (size_t col = 0; col < _lstRawData->getCells(row); ++col)
+		{
+			page.rows[row].cells.push_back(_lstRawData->getCellText(row, col));
+			page.rows[row].colors.push_back(_lstRawData->getCellColor(row, col));
+		}
+	}
 }
 
 /**
@@ -19,6 +19,7 @@
  */
 #include "../Battlescape/Position.h"
 #include "../Engine/State.h"
+#include "../Interface/Text.h"
 #include "../Mod/ArticleDefinition.h"
 #include "../Mod/Armor.h"
 #include "../Mod/MapData.h"
@@ -63,6 +64,23 @@ private:
 	int _counter;
 	bool _indent;
 
+	/// A row of the table, with one cell if it floods both columns.
+	struct CachedRow
+	{
+		std::vector<std::string> cells;
+		std::vector<Uint8> colors;
+	};
+	/// The table built for one combination of the toggle buttons.
+	struct CachedPage
+	{
+		std::string article;
+		std::vector<CachedRow> rows;
+		std::vector<std::string> filterOptions;
+		bool filterVisible = false;
+		TextHAlign titleAlign = ALIGN_CENTER;
+	};
+	std::map<int, CachedPage> _cachedPages;
+
 	void buildUI(bool debug, bool ids, bool defaults);
 	void initLists();
 	void resetStream(std::ostringstream &ss);
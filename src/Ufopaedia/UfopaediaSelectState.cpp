@@ -207,6 +207,24 @@ namespace OpenXcom
 		loadSelectionList(true);
 	}
 
+	/**
+	 * Gets the upper case title of an article, for the quick search.
+	 * Titles are only translated once, not on every search.
+	 * @param article Article definition.
+	 * @return Upper case title.
+	 */
+	const std::string &UfopaediaSelectState::getSearchName(ArticleDefinition *article)
+	{
+		std::unordered_map<ArticleDefinition*, std::string>::iterator i = _searchNames.find(article);
+		if (i == _searchNames.end())
+		{
+			std::string name = tr(article->getMainTitle());
+			Unicode::upperCase(name);
+			i = _searchNames.insert(std::make_pair(article, name)).first;
+		}
+		return i->second;
+	}
+
 	void UfopaediaSelectState::loadSelectionList(bool markAllAsSeen)
 	{
 		bool isCommendationsSection = (_section == UFOPAEDIA_COMMENDATIONS);
@@ -247,9 +265,7 @@ namespace OpenXcom
 			// quick search
 			if (!searchString.empty())
 			{
-				std::string projectName = tr((*it)->getMainTitle());
-				Unicode::upperCase(projectName);
-				if (projectName.find(searchString) == std::string::npos)
+				if (getSearchName(*it).find(searchString) == std::string::npos)
 				{
 					continue;
 				}
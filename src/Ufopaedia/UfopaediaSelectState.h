@@ -20,6 +20,7 @@
 #include "../Engine/State.h"
 #include "Ufopaedia.h"
 #include <string>
+#include <unordered_map>
 
 namespace OpenXcom
 {
@@ -51,6 +52,7 @@ namespace OpenXcom
 		ToggleTextButton *_btnShowOnlyNew;
 		TextList *_lstSelection;
 		ArticleDefinitionList _article_list, _filtered_article_list;
+		std::unordered_map<ArticleDefinition*, std::string> _searchNames;
 		size_t _lstScroll;
 		Uint8 _colorNormal, _colorNew;
 
@@ -66,6 +68,8 @@ namespace OpenXcom
 		void btnShowOnlyNewClick(Action *action);
 		/// Handler for clicking the [Mark All As Seen] button.
 		void btnMarkAllAsSeenClick(Action *action);
+		/// Gets the upper case title of an article, for the quick search.
+		const std::string &getSearchName(ArticleDefinition *article);
 		/// load available articles into the selection list
 		void loadSelectionList(bool markAllAsSeen);
 	};